@@ -48,6 +48,7 @@ enum Order : int;
 #include <iterator>
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -242,10 +243,53 @@ public:
    */
   std::size_t distribute_dofs (MeshBase &);
 
+  /**
+   * Enables or disables incremental dof numbering.  When enabled,
+   * \p distribute_dofs() after a local refinement or coarsening of
+   * the mesh keeps the indices of the dofs on objects which this
+   * processor owned, and which kept the same number of dofs, wherever
+   * the processor's dof range allows it; only dofs on new (or
+   * changed) objects get new indices, placed in the gaps left by
+   * deleted objects.  Where the changes do not fit in those gaps,
+   * the surviving dofs are compacted, in their previous order.
+   *
+   * Incremental numbering does not give the locality of a fresh
+   * numbering, so every \p full_renumbering_interval incremental
+   * numberings (never, if zero) the dofs are numbered from scratch
+   * instead.
+   *
+   * Incremental numbering requires AMR support; it is disabled by
+   * default.
+   */
+  void set_incremental_dof_numbering (bool incremental,
+                                      unsigned int full_renumbering_interval = 0);
+
+  /**
+   * \returns The fraction of the degrees of freedom whose index was
+   * changed by the last \p distribute_dofs(): 1 after a full
+   * numbering, and typically much less after an incremental one.
+   */
+  Real fraction_dofs_renumbered () const { return _fraction_dofs_renumbered; }
+
+  /**
+   * If the last \p distribute_dofs() was incremental and left every
+   * degree of freedom, every element and every constraint as it was,
+   * marks the sparsity pattern as current and returns \p true: the
+   * matrices built on it need not be reinitialized.  Otherwise
+   * returns \p false.
+   *
+   * This must be called on all processors at once.
+   */
+  bool keep_sparsity_pattern ();
+
   /**
    * Computes the sparsity pattern for the matrices corresponding to
    * \p proc_id and sends that data to Linear Algebra packages for
    * preallocation of sparse matrices.
+   *
+   * After an incremental \p distribute_dofs(), only the rows of the
+   * dofs near new elements, renumbered dofs or changed constraints
+   * are rebuilt, and the others are kept from the previous pattern.
    */
   void compute_sparsity (const MeshBase &);
 
@@ -1585,6 +1629,40 @@ private:
   void distribute_local_dofs_node_major (dof_id_type & next_free_dof,
                                          MeshBase & mesh);
 
+#ifdef LIBMESH_ENABLE_AMR
+  /**
+   * Replaces the temporary local dof indices, numbered from zero by
+   * \p distribute_local_dofs_var_major or \p
+   * distribute_local_dofs_node_major, with permanent ones which keep
+   * the previous indices of surviving dofs where possible (see \p
+   * set_incremental_dof_numbering()).  \p old_n_SCALAR_dofs is the
+   * number of SCALAR dofs in the previous numbering.
+   *
+   * \returns The number of local dofs whose index was kept.
+   */
+  dof_id_type distribute_local_dofs_incremental (MeshBase & mesh,
+                                                 dof_id_type old_n_SCALAR_dofs);
+
+  /**
+   * \returns Whether the sparsity pattern was computed for the
+   * numbering which the last, incremental, \p distribute_dofs()
+   * replaced, so that the new pattern can be built from it.
+   */
+  bool sparsity_reusable () const;
+
+  /**
+   * Builds the sparsity pattern for an incremental numbering from
+   * the previous one, rebuilding only the rows of the dofs on
+   * elements which are new, have renumbered or differently
+   * constrained dofs, or are coupled to elements which do.  Rows
+   * which merely lost couplings keep them, which only overallocates.
+   *
+   * \returns nullptr, on every processor, if the pattern has to be
+   * built from scratch instead.
+   */
+  std::unique_ptr<SparsityPattern::Build> update_sparsity (const MeshBase & mesh) const;
+#endif
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1912,6 +1990,44 @@ private:
    */
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
+
+  /**
+   * Whether to number dofs incrementally after mesh changes, how
+   * many incremental numberings to allow between full numberings,
+   * and how many have been done since the last full one.
+   */
+  bool _incremental_dof_numbering;
+  unsigned int _full_renumbering_interval;
+  unsigned int _n_incremental_numberings;
+
+  /**
+   * Whether the current numbering was done incrementally, in which
+   * case local dof indices no longer ascend in traversal order.
+   */
+  bool _dofs_numbered_incrementally;
+
+  /**
+   * The fraction of dofs renumbered by the last \p distribute_dofs().
+   */
+  Real _fraction_dofs_renumbered;
+
+  /**
+   * How many times \p distribute_dofs() has numbered the dofs, and
+   * how many times it had when the sparsity pattern was computed.
+   */
+  unsigned int _n_dof_distributions;
+  unsigned int _sparsity_dof_distribution;
+
+  /**
+   * With incremental numbering, the ids of the elements which the
+   * last \p distribute_dofs() found just refined or coarsened (the
+   * mesh forgets the latter when it is contracted), and the
+   * constraints the sparsity pattern was computed with.
+   */
+  std::unordered_set<dof_id_type> _changed_elems;
+#ifdef LIBMESH_ENABLE_CONSTRAINTS
+  DofConstraints _sparsity_constraints;
+#endif
 };
 
 
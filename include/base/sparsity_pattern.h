@@ -25,6 +25,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <set>
 #include <vector>
 #include <unordered_set>
 
@@ -171,6 +172,17 @@ public:
   const std::vector<dof_id_type> & get_n_oz() const
   { return n_oz; }
 
+  /**
+   * Replaces our rows, except those of the dofs in \p rebuilt_rows,
+   * with the rows of the same dofs in the full pattern \p old, whose
+   * first row was that of dof \p old_first_dof, dropping columns
+   * beyond the current number of dofs, and recounts our nonzeros.
+   * Used to update a pattern after an incremental dof numbering.
+   */
+  void keep_rows (const Build & old,
+                  const dof_id_type old_first_dof,
+                  const std::set<dof_id_type> & rebuilt_rows);
+
   /**
    * Let a user-provided AugmentSparsityPattern subclass modify our
    * sparsity structure.
@@ -24,12 +24,17 @@ namespace libMesh {
 
 /**
  * Defines an \p enum for matrix build types. This is useful for telling \p System
- * derived objects what type of matrix to build
+ * derived objects what type of matrix to build.
+ *
+ * \p REDUCED_PRECISION requests a matrix storing single precision
+ * values.  Only Eigen supports it; packages whose scalar type is
+ * fixed at configure time, like PETSc, reject it.
  */
 enum class MatrixBuildType
 {
   AUTOMATIC,
-  DIAGONAL
+  DIAGONAL,
+  REDUCED_PRECISION
 };
 }
 
@@ -21,17 +21,13 @@
 #define LIBMESH_HP_COARSENTEST_H
 
 // Local Includes
-#include "libmesh/dense_matrix.h"
-#include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/hp_selector.h"
 #include "libmesh/id_types.h"
 #include "libmesh/libmesh_common.h"
-#include "libmesh/fe.h"         // MipsPro requires fe.h and quadrature.h
-#include "libmesh/quadrature.h" // Required for inline deletion std::unique_ptrs<> in destructor
 
 // C++ includes
 #include <vector>
-#include <memory>
 
 #ifdef LIBMESH_ENABLE_AMR
 
@@ -40,14 +36,7 @@ namespace libMesh
 
 // Forward Declarations
 class Elem;
-class Point;
 class System;
-template <typename T> class TensorValue;
-template <typename T> class VectorValue;
-typedef VectorValue<Real> RealVectorValue;
-typedef TensorValue<Real> RealTensorValue;
-typedef RealVectorValue RealGradient;
-typedef RealTensorValue RealTensor;
 
 
 /**
@@ -61,6 +50,13 @@ typedef RealTensorValue RealTensor;
  * This code is currently experimental and will not produce optimal
  * hp meshes without significant improvement.
  *
+ * The projections are computed in parallel on each thread, with
+ * finite element objects and dense workspaces reused from element to
+ * element.  The locations of a child's quadrature points in the
+ * master element of an affine parent depend only on the parent's
+ * type and the child's number, so these are computed once per thread
+ * and reused.
+ *
  * \author Roy H. Stogner
  * \date 2006
  */
@@ -77,17 +73,13 @@ public:
   }
 
   /**
-   * This class cannot be (default) copy constructed/assigned because
-   * it has unique_ptr members. Explicitly deleting these functions is
-   * the best way to document this fact.
-   */
-  HPCoarsenTest (const HPCoarsenTest &) = delete;
-  HPCoarsenTest & operator= (const HPCoarsenTest &) = delete;
-
-  /**
-   * Defaulted move ctor, move assignment operator, and destructor.
+   * Copy/move ctor, copy/move assignment operator, and destructor are
+   * all explicitly defaulted for this class, whose finite element
+   * objects and workspaces now all live in the threaded worker.
    */
+  HPCoarsenTest (const HPCoarsenTest &) = default;
   HPCoarsenTest (HPCoarsenTest &&) = default;
+  HPCoarsenTest & operator= (const HPCoarsenTest &) = default;
   HPCoarsenTest & operator= (HPCoarsenTest &&) = default;
   virtual ~HPCoarsenTest() = default;
 
@@ -107,60 +99,68 @@ public:
 
 protected:
   /**
-   * The helper function which adds individual fine element data to
-   * the coarse element projection
-   */
-  void add_projection(const System &, const Elem *, unsigned int var);
-
-  /**
-   * The coarse element on which a solution projection is cached
-   */
-  Elem * coarse;
-
-  /**
-   * Global DOF indices for fine elements
-   */
-  std::vector<dof_id_type> dof_indices;
-
-  /**
-   * The finite element objects for fine and coarse elements
-   */
-  std::unique_ptr<FEBase> fe, fe_coarse;
-
-  /**
-   * The shape functions and their derivatives
+   * Class to compute the h and p coarsening errors of one variable
+   * in parallel on each thread.  The objects in its range are either
+   * parents, all of whose active local children flagged for h
+   * refinement are handled together, since they share one projection
+   * onto the parent and since the parent's p level is temporarily
+   * changed, or flagged elements without a parent.
    */
-  const std::vector<std::vector<Real>> * phi, * phi_coarse;
-  const std::vector<std::vector<RealGradient>> * dphi, * dphi_coarse;
-  const std::vector<std::vector<RealTensor>> * d2phi, * d2phi_coarse;
-
-  /**
-   * Mapping jacobians
-   */
-  const std::vector<Real> * JxW;
-
-  /**
-   * Quadrature locations
-   */
-  const std::vector<Point> * xyz_values;
-  std::vector<Point> coarse_qpoints;
-
-  /**
-   * The quadrature rule for the fine element
-   */
-  std::unique_ptr<QBase> qrule;
-
-  /**
-   * Linear system for projections
-   */
-  DenseMatrix<Number> Ke;
-  DenseVector<Number> Fe;
-  /**
-   * Coefficients for projected coarse and projected
-   * p-derefined solutions
-   */
-  DenseVector<Number> Uc;
-  DenseVector<Number> Up;
+  class EstimateProjectionErrors
+  {
+  public:
+    EstimateProjectionErrors (const System & sys,
+                              unsigned int var,
+                              Real scale,
+                              std::vector<ErrorVectorReal> & h_error,
+                              std::vector<ErrorVectorReal> & p_error) :
+      system(sys),
+      var_num(var),
+      component_scale(scale),
+      h_error_per_cell(h_error),
+      p_error_per_cell(p_error)
+    {}
+
+    void operator()(const ElemRange & range) const;
+
+  private:
+    /**
+     * The finite element objects, quadrature rule and dense
+     * workspaces of one thread, reused from element to element.
+     */
+    struct Scratch;
+
+    /**
+     * Reinitializes the fine finite element on \p elem and evaluates
+     * the solution at its quadrature points.
+     */
+    void fine_values (const Elem & elem, Scratch & s) const;
+
+    /**
+     * Reinitializes the coarse finite element on \p coarse, an
+     * ancestor of \p elem, at the quadrature points of \p elem.
+     */
+    void reinit_coarse (const Elem & elem, const Elem & coarse, Scratch & s) const;
+
+    /**
+     * Adds the projection of the solution on \p elem, or on its
+     * active descendants, onto \p coarse to the projection system.
+     */
+    void add_projection (const Elem & elem, const Elem & coarse, Scratch & s) const;
+
+    /**
+     * Adds the h and p coarsening errors of \p elem, with \p coarse
+     * its parent (or \p nullptr) on whose projection \p s.Uc
+     * holds the coefficients.
+     */
+    void add_errors (Elem & elem, Elem * coarse, Scratch & s) const;
+
+    const System & system;
+    const unsigned int var_num;
+    const Real component_scale;
+    std::vector<ErrorVectorReal> & h_error_per_cell;
+    std::vector<ErrorVectorReal> & p_error_per_cell;
+  };
 };
 
 } // namespace libMesh
@@ -21,6 +21,7 @@
 #define LIBMESH_HP_SINGULAR_H
 
 // Local Includes
+#include "libmesh/elem_range.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
 
@@ -81,6 +82,24 @@ public:
    * all singular points in the solution.
    */
   std::list<Point> singular_points;
+
+protected:
+  /**
+   * Class to choose between h and p refinement for each element in
+   * parallel on each thread.
+   */
+  class SelectRefinement
+  {
+  public:
+    SelectRefinement (const HPSingularity & hps) :
+      selector(hps)
+    {}
+
+    void operator()(const ElemRange & range) const;
+
+  private:
+    const HPSingularity & selector;
+  };
 };
 
 } // namespace libMesh
@@ -23,6 +23,7 @@
 // Local Includes
 #include "libmesh/error_estimator.h"
 #include "libmesh/libmesh.h"
+#include "libmesh/patch.h"
 
 // C++ includes
 #include <cstddef>
@@ -33,12 +34,19 @@
 namespace libMesh
 {
 
+// Forward declarations
+class FEMSystem;
+
 /**
  * This class implements a ``brute force'' error estimator
  * which integrates differences between the current solution
  * and the solution on a uniformly refined (in h and/or p,
  * for an arbitrary number of levels) grid.
  *
+ * The fine grid solution can be approximated by independent solves
+ * on element patches, see \p patch_local_solves, in place of a
+ * global solve on the refined grid.
+ *
  * \author Roy H. Stogner
  * \date 2006
  */
@@ -120,6 +128,39 @@ public:
    */
   unsigned char number_p_refinements;
 
+  /**
+   * If \p true, the solution on the fine grid is not found with a
+   * global solve.  Instead, a small problem is solved on a patch of
+   * fine elements around each coarse element, using the fine grid
+   * residual and Jacobian of the system while holding the degrees of
+   * freedom outside the patch at their projected values, and the
+   * corrections the patches make to each degree of freedom are
+   * averaged.  Each processor only solves for the degrees of
+   * freedom it owns.
+   *
+   * Only an \p FEMSystem, which can assemble each patch problem
+   * from the patch elements alone, is solved this way, with its
+   * patches assembled and solved on all threads at once; its
+   * matrices are neither allocated nor assembled on the fine grid.
+   * The mesh itself, and so the solution and other vectors, are
+   * still refined globally.  Other systems, and adjoint solves,
+   * still use a global solve.  Defaults to \p false.
+   */
+  bool patch_local_solves;
+
+  /**
+   * The number of times \p patch_growth_strategy is applied to the
+   * fine elements of a coarse element to build its patch.  Defaults
+   * to 1.
+   */
+  unsigned int n_patch_layers;
+
+  /**
+   * The method used to grow patches for \p patch_local_solves.
+   * Defaults to \p Patch::add_local_point_neighbors.
+   */
+  Patch::PMF patch_growth_strategy;
+
 protected:
   /**
    * The code for estimate_error and both estimate_errors versions is very
@@ -132,6 +173,15 @@ protected:
                                 const std::map<const System *, SystemNorm > * error_norms,
                                 const std::map<const System *, const NumericVector<Number> *> * solution_vectors = nullptr,
                                 bool estimate_parent_error = false);
+
+  /**
+   * Replaces the projected solution of \p system on the fine grid
+   * with the average of the patch local corrections to it; see \p
+   * patch_local_solves.  Elements with ids below \p
+   * max_coarse_elem_id belong to the coarse grid.
+   */
+  void _patch_local_solve (FEMSystem & system,
+                           dof_id_type max_coarse_elem_id);
 };
 
 } // namespace libMesh
@@ -248,6 +248,22 @@ public:
                            std::vector<OutputShape> & v,
                            const bool add_p_level = true);
 
+  /**
+   * Fills \p comps[j][i][qp] with the \f$ j^{th} \f$ derivative of
+   * the \f$ i^{th} \f$ shape function, evaluated at points qp in p,
+   * for every master coordinate j < Dim.  You must specify element
+   * order directly.  \p comps should already be the appropriate size.
+   *
+   * On a p-refined element, \p o should be the base order of the
+   * element if \p add_p_level is left \p true, or can be the base
+   * order of the element if \p add_p_level is set to \p false.
+   */
+  static void all_shape_derivs(const Elem * elem,
+                               const Order o,
+                               const std::vector<Point> & p,
+                               std::vector<std::vector<OutputShape>> * comps[3],
+                               const bool add_p_level = true);
+
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
@@ -634,6 +650,23 @@ protected:
         v[vi] = FE<Dim,T>::shape_deriv (elem, o, i, j, p[vi], add_p_level);
     }
 
+  /**
+   * A default implementation for all_shape_derivs
+   */
+  static void default_all_shape_derivs (const Elem * elem,
+                                        const Order o,
+                                        const std::vector<Point> & p,
+                                        std::vector<std::vector<OutputShape>> * comps[3],
+                                        const bool add_p_level = true)
+    {
+      for (unsigned int j = 0; j != Dim; ++j)
+        {
+          libmesh_assert(comps[j]);
+          for (auto i : index_range(*comps[j]))
+            FE<Dim,T>::shape_derivs (elem, o, i, j, p, (*comps[j])[i], add_p_level);
+        }
+    }
+
   /**
    * An array of the node locations on the last
    * element we computed on
@@ -1280,6 +1313,18 @@ void FE<MyDim,MyType>::shape_derivs                  \
 {                                                    \
   FE<MyDim,MyType>::default_shape_derivs             \
     (elem,o,i,j,p,v,add_p_level);                    \
+}                                                    \
+                                                     \
+template<>                                           \
+void FE<MyDim,MyType>::all_shape_derivs              \
+  (const Elem * elem,                                \
+   const Order o,                                    \
+   const std::vector<Point> & p,                     \
+   std::vector<std::vector<OutputShape>> * comps[3], \
+   const bool add_p_level)                           \
+{                                                    \
+  FE<MyDim,MyType>::default_all_shape_derivs         \
+    (elem,o,p,comps,add_p_level);                    \
 }
 
 
@@ -282,6 +282,27 @@ public:
   const std::vector<Real> & get_JxW() const
   { calculate_map = true; return this->_fe_map->get_JxW(); }
 
+  /**
+   * \returns The \p xyz spatial locations of the quadrature points,
+   * as a contiguous, aligned array indexed [component][qp].
+   */
+  const AlignedArray2D<Real> & get_contiguous_xyz() const
+  { calculate_map = true; return this->_fe_map->get_contiguous_xyz(); }
+
+  /**
+   * \returns The element Jacobian times the quadrature weight, as a
+   * contiguous, aligned array indexed [0][qp].
+   */
+  const AlignedArray2D<Real> & get_contiguous_JxW() const
+  { calculate_map = true; return this->_fe_map->get_contiguous_JxW(); }
+
+  /**
+   * \returns The inverse map derivatives d(xi_j)/d(x_k) as a
+   * contiguous, aligned array indexed [3*j+k][qp].
+   */
+  const AlignedArray2D<Real> & get_contiguous_dxidxyz() const
+  { calculate_map = true; return this->_fe_map->get_contiguous_dxidxyz(); }
+
   /**
    * \returns The element tangents in xi-direction at the quadrature
    * points.
@@ -22,6 +22,7 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/aligned_array_2d.h"
 #include "libmesh/compare_types.h"
 #include "libmesh/fe_abstract.h"
 #include "libmesh/fe_transformation_base.h"
@@ -288,6 +289,52 @@ public:
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphidz; }
 
+  /**
+   * \returns The shape function values at the quadrature points, in
+   * a single contiguous, aligned buffer indexed [i][qp].
+   *
+   * Contiguous copies are only made for the quantities which have
+   * been requested through these accessors, after the usual
+   * std::vector<std::vector<>> data has been computed; they are
+   * meant for hot user loops over quadrature points, which compilers
+   * can then vectorize.
+   */
+  const AlignedArray2D<OutputShape> & get_contiguous_phi() const
+  { libmesh_assert(!calculations_started || calculate_contiguous_phi);
+    calculate_phi = calculate_contiguous_phi = true; return contiguous_phi; }
+
+  /**
+   * \returns The shape function gradients at the quadrature points,
+   * in a single contiguous, aligned buffer indexed [i][qp].
+   */
+  const AlignedArray2D<OutputGradient> & get_contiguous_dphi() const
+  { libmesh_assert(!calculations_started || calculate_contiguous_dphi);
+    calculate_dphi = calculate_dphiref = calculate_contiguous_dphi = true; return contiguous_dphi; }
+
+  /**
+   * \returns The shape function x-derivatives at the quadrature
+   * points, in a single contiguous, aligned buffer indexed [i][qp].
+   */
+  const AlignedArray2D<OutputShape> & get_contiguous_dphidx() const
+  { libmesh_assert(!calculations_started || calculate_contiguous_dphi);
+    calculate_dphi = calculate_dphiref = calculate_contiguous_dphi = true; return contiguous_dphidx; }
+
+  /**
+   * \returns The shape function y-derivatives at the quadrature
+   * points, in a single contiguous, aligned buffer indexed [i][qp].
+   */
+  const AlignedArray2D<OutputShape> & get_contiguous_dphidy() const
+  { libmesh_assert(!calculations_started || calculate_contiguous_dphi);
+    calculate_dphi = calculate_dphiref = calculate_contiguous_dphi = true; return contiguous_dphidy; }
+
+  /**
+   * \returns The shape function z-derivatives at the quadrature
+   * points, in a single contiguous, aligned buffer indexed [i][qp].
+   */
+  const AlignedArray2D<OutputShape> & get_contiguous_dphidz() const
+  { libmesh_assert(!calculations_started || calculate_contiguous_dphi);
+    calculate_dphi = calculate_dphiref = calculate_contiguous_dphi = true; return contiguous_dphidz; }
+
   /**
    * \returns The shape function xi-derivative at the quadrature
    * points.
@@ -664,6 +711,28 @@ protected:
    */
   std::vector<std::vector<OutputShape>>   dphidz;
 
+  /**
+   * Copies whichever of the above have been requested in contiguous
+   * form into the contiguous_* arrays below.
+   */
+  void copy_to_contiguous();
+
+  /**
+   * Should we make contiguous copies of phi or of its first
+   * derivatives?
+   */
+  mutable bool calculate_contiguous_phi;
+  mutable bool calculate_contiguous_dphi;
+
+  /**
+   * Contiguous copies of phi, dphi, dphidx, dphidy and dphidz.
+   */
+  AlignedArray2D<OutputShape>    contiguous_phi;
+  AlignedArray2D<OutputGradient> contiguous_dphi;
+  AlignedArray2D<OutputShape>    contiguous_dphidx;
+  AlignedArray2D<OutputShape>    contiguous_dphidy;
+  AlignedArray2D<OutputShape>    contiguous_dphidz;
+
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
 
@@ -838,7 +907,9 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   dphidzeta(),
   dphidx(),
   dphidy(),
-  dphidz()
+  dphidz(),
+  calculate_contiguous_phi(false),
+  calculate_contiguous_dphi(false)
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   ,d2phi(),
   dual_d2phi(),
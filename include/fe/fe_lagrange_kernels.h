@@ -0,0 +1,588 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_FE_LAGRANGE_KERNELS_H
+#define LIBMESH_FE_LAGRANGE_KERNELS_H
+
+// Local includes
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/int_range.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+// Fixed-size Lagrange shape function kernels for the element types
+// which make up the bulk of most meshes.  Each kernel evaluates every
+// shape function (or every first derivative of every shape function)
+// of its element at a single point into a stack array whose size is
+// known at compile time, so the loops below can be fully unrolled and
+// vectorized instead of going through the run-time (type, order, i,
+// j) switches of the generic Lagrange implementation.
+//
+// The node numbering, and the arithmetic, follow those switches
+// exactly.
+
+namespace libMesh
+{
+
+/**
+ * One dimensional Lagrange bases on [-1,1] with \p N nodes, in the
+ * (left, right, middle) ordering used by the tensor product elements.
+ */
+template <unsigned int N>
+struct Lagrange1DKernel;
+
+template <>
+struct Lagrange1DKernel<2>
+{
+  static void shapes (const Real xi, Real (&l)[2])
+  {
+    l[0] = .5*(1. - xi);
+    l[1] = .5*(1. + xi);
+  }
+
+  static void shape_derivs (const Real, Real (&dl)[2])
+  {
+    dl[0] = -.5;
+    dl[1] = .5;
+  }
+};
+
+template <>
+struct Lagrange1DKernel<3>
+{
+  static void shapes (const Real xi, Real (&l)[3])
+  {
+    l[0] = .5*xi*(xi - 1.);
+    l[1] = .5*xi*(xi + 1);
+    l[2] = (1. - xi*xi);
+  }
+
+  static void shape_derivs (const Real xi, Real (&dl)[3])
+  {
+    dl[0] = xi-.5;
+    dl[1] = xi+.5;
+    dl[2] = -2.*xi;
+  }
+};
+
+
+
+/**
+ * Tensor product kernels.  \p Indices provides the 1D node indices
+ * i0, i1 (and i2) of each shape function.
+ */
+template <typename Indices>
+struct LagrangeQuadKernel
+{
+  static const unsigned int dim = 2;
+  static const unsigned int n_shapes = Indices::n_shapes;
+  typedef Lagrange1DKernel<Indices::n_1D> Kernel1D;
+
+  static void shapes (const Point & p, Real (&phi)[n_shapes])
+  {
+    Real lx[Indices::n_1D], ly[Indices::n_1D];
+    Kernel1D::shapes(p(0), lx);
+    Kernel1D::shapes(p(1), ly);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      phi[i] = lx[Indices::i0(i)] * ly[Indices::i1(i)];
+  }
+
+  static void shape_derivs (const Point & p, Real (&dphi)[dim][n_shapes])
+  {
+    Real lx[Indices::n_1D], ly[Indices::n_1D],
+      dlx[Indices::n_1D], dly[Indices::n_1D];
+    Kernel1D::shapes(p(0), lx);
+    Kernel1D::shapes(p(1), ly);
+    Kernel1D::shape_derivs(p(0), dlx);
+    Kernel1D::shape_derivs(p(1), dly);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      {
+        dphi[0][i] = dlx[Indices::i0(i)] * ly[Indices::i1(i)];
+        dphi[1][i] = lx[Indices::i0(i)] * dly[Indices::i1(i)];
+      }
+  }
+};
+
+template <typename Indices>
+struct LagrangeHexKernel
+{
+  static const unsigned int dim = 3;
+  static const unsigned int n_shapes = Indices::n_shapes;
+  typedef Lagrange1DKernel<Indices::n_1D> Kernel1D;
+
+  static void shapes (const Point & p, Real (&phi)[n_shapes])
+  {
+    Real lx[Indices::n_1D], ly[Indices::n_1D], lz[Indices::n_1D];
+    Kernel1D::shapes(p(0), lx);
+    Kernel1D::shapes(p(1), ly);
+    Kernel1D::shapes(p(2), lz);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      phi[i] = lx[Indices::i0(i)] * ly[Indices::i1(i)] * lz[Indices::i2(i)];
+  }
+
+  static void shape_derivs (const Point & p, Real (&dphi)[dim][n_shapes])
+  {
+    Real lx[Indices::n_1D], ly[Indices::n_1D], lz[Indices::n_1D],
+      dlx[Indices::n_1D], dly[Indices::n_1D], dlz[Indices::n_1D];
+    Kernel1D::shapes(p(0), lx);
+    Kernel1D::shapes(p(1), ly);
+    Kernel1D::shapes(p(2), lz);
+    Kernel1D::shape_derivs(p(0), dlx);
+    Kernel1D::shape_derivs(p(1), dly);
+    Kernel1D::shape_derivs(p(2), dlz);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      {
+        const unsigned int a = Indices::i0(i),
+                           b = Indices::i1(i),
+                           c = Indices::i2(i);
+        dphi[0][i] = dlx[a] * ly[b] * lz[c];
+        dphi[1][i] = lx[a] * dly[b] * lz[c];
+        dphi[2][i] = lx[a] * ly[b] * dlz[c];
+      }
+  }
+};
+
+struct Quad4Indices
+{
+  static const unsigned int n_1D = 2;
+  static const unsigned int n_shapes = 4;
+  static unsigned int i0 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 1, 1, 0};
+    return v[i];
+  }
+  static unsigned int i1 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 0, 1, 1};
+    return v[i];
+  }
+};
+
+struct Quad9Indices
+{
+  static const unsigned int n_1D = 3;
+  static const unsigned int n_shapes = 9;
+  static unsigned int i0 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 1, 1, 0, 2, 1, 2, 0, 2};
+    return v[i];
+  }
+  static unsigned int i1 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 0, 1, 1, 0, 2, 1, 2, 2};
+    return v[i];
+  }
+};
+
+struct Hex8Indices
+{
+  static const unsigned int n_1D = 2;
+  static const unsigned int n_shapes = 8;
+  static unsigned int i0 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 1, 1, 0, 0, 1, 1, 0};
+    return v[i];
+  }
+  static unsigned int i1 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 0, 1, 1, 0, 0, 1, 1};
+    return v[i];
+  }
+  static unsigned int i2 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 0, 0, 0, 1, 1, 1, 1};
+    return v[i];
+  }
+};
+
+struct Hex27Indices
+{
+  static const unsigned int n_1D = 3;
+  static const unsigned int n_shapes = 27;
+  static unsigned int i0 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 1, 1, 0, 0, 1, 1, 0, 2, 1, 2, 0, 0, 1, 1, 0, 2, 1, 2, 0, 2, 2, 1, 2, 0, 2, 2};
+    return v[i];
+  }
+  static unsigned int i1 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 1, 2, 0, 0, 1, 1, 0, 2, 1, 2, 2, 0, 2, 1, 2, 2, 2};
+    return v[i];
+  }
+  static unsigned int i2 (const unsigned int i)
+  {
+    static const unsigned char v[] = {0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 2, 2, 1, 1, 1, 1, 0, 2, 2, 2, 2, 1, 2};
+    return v[i];
+  }
+};
+
+typedef LagrangeQuadKernel<Quad4Indices> LagrangeQuad4Kernel;
+typedef LagrangeQuadKernel<Quad9Indices> LagrangeQuad9Kernel;
+typedef LagrangeHexKernel<Hex8Indices>   LagrangeHex8Kernel;
+typedef LagrangeHexKernel<Hex27Indices>  LagrangeHex27Kernel;
+
+
+
+/**
+ * Simplex kernels, in area/volume coordinates.
+ */
+struct LagrangeTri3Kernel
+{
+  static const unsigned int dim = 2;
+  static const unsigned int n_shapes = 3;
+
+  static void shapes (const Point & p, Real (&phi)[n_shapes])
+  {
+    phi[0] = 1. - p(0) - p(1);
+    phi[1] = p(0);
+    phi[2] = p(1);
+  }
+
+  static void shape_derivs (const Point &, Real (&dphi)[dim][n_shapes])
+  {
+    dphi[0][0] = -1.; dphi[0][1] = 1.; dphi[0][2] = 0.;
+    dphi[1][0] = -1.; dphi[1][1] = 0.; dphi[1][2] = 1.;
+  }
+};
+
+struct LagrangeTri6Kernel
+{
+  static const unsigned int dim = 2;
+  static const unsigned int n_shapes = 6;
+
+  static void shapes (const Point & p, Real (&phi)[n_shapes])
+  {
+    const Real zeta1 = p(0);
+    const Real zeta2 = p(1);
+    const Real zeta0 = 1. - zeta1 - zeta2;
+
+    phi[0] = 2.*zeta0*(zeta0-0.5);
+    phi[1] = 2.*zeta1*(zeta1-0.5);
+    phi[2] = 2.*zeta2*(zeta2-0.5);
+    phi[3] = 4.*zeta0*zeta1;
+    phi[4] = 4.*zeta1*zeta2;
+    phi[5] = 4.*zeta2*zeta0;
+  }
+
+  static void shape_derivs (const Point & p, Real (&dphi)[dim][n_shapes])
+  {
+    const Real zeta1 = p(0);
+    const Real zeta2 = p(1);
+    const Real zeta0 = 1. - zeta1 - zeta2;
+
+    dphi[0][0] = -(4.*zeta0-1.);
+    dphi[0][1] = 4.*zeta1-1.;
+    dphi[0][2] = 0.;
+    dphi[0][3] = 4.*zeta0 - 4.*zeta1;
+    dphi[0][4] = 4.*zeta2;
+    dphi[0][5] = -4.*zeta2;
+
+    dphi[1][0] = -(4.*zeta0-1.);
+    dphi[1][1] = 0.;
+    dphi[1][2] = 4.*zeta2-1.;
+    dphi[1][3] = -4.*zeta1;
+    dphi[1][4] = 4.*zeta1;
+    dphi[1][5] = 4.*zeta0 - 4.*zeta2;
+  }
+};
+
+struct LagrangeTet4Kernel
+{
+  static const unsigned int dim = 3;
+  static const unsigned int n_shapes = 4;
+
+  static void shapes (const Point & p, Real (&phi)[n_shapes])
+  {
+    phi[0] = 1. - p(0) - p(1) - p(2);
+    phi[1] = p(0);
+    phi[2] = p(1);
+    phi[3] = p(2);
+  }
+
+  static void shape_derivs (const Point &, Real (&dphi)[dim][n_shapes])
+  {
+    dphi[0][0] = -1.; dphi[0][1] = 1.; dphi[0][2] = 0.; dphi[0][3] = 0.;
+    dphi[1][0] = -1.; dphi[1][1] = 0.; dphi[1][2] = 1.; dphi[1][3] = 0.;
+    dphi[2][0] = -1.; dphi[2][1] = 0.; dphi[2][2] = 0.; dphi[2][3] = 1.;
+  }
+};
+
+struct LagrangeTet10Kernel
+{
+  static const unsigned int dim = 3;
+  static const unsigned int n_shapes = 10;
+
+  static void shapes (const Point & p, Real (&phi)[n_shapes])
+  {
+    const Real zeta1 = p(0);
+    const Real zeta2 = p(1);
+    const Real zeta3 = p(2);
+    const Real zeta0 = 1. - zeta1 - zeta2 - zeta3;
+
+    phi[0] = zeta0*(2.*zeta0 - 1.);
+    phi[1] = zeta1*(2.*zeta1 - 1.);
+    phi[2] = zeta2*(2.*zeta2 - 1.);
+    phi[3] = zeta3*(2.*zeta3 - 1.);
+    phi[4] = 4.*zeta0*zeta1;
+    phi[5] = 4.*zeta1*zeta2;
+    phi[6] = 4.*zeta2*zeta0;
+    phi[7] = 4.*zeta0*zeta3;
+    phi[8] = 4.*zeta1*zeta3;
+    phi[9] = 4.*zeta2*zeta3;
+  }
+
+  static void shape_derivs (const Point & p, Real (&dphi)[dim][n_shapes])
+  {
+    const Real zeta1 = p(0);
+    const Real zeta2 = p(1);
+    const Real zeta3 = p(2);
+    const Real zeta0 = 1. - zeta1 - zeta2 - zeta3;
+
+    const Real v0 = -(4.*zeta0 - 1.);
+
+    dphi[0][0] = v0;
+    dphi[0][1] = 4.*zeta1 - 1.;
+    dphi[0][2] = 0.;
+    dphi[0][3] = 0.;
+    dphi[0][4] = 4.*(zeta0 - zeta1);
+    dphi[0][5] = 4.*zeta2;
+    dphi[0][6] = -4.*zeta2;
+    dphi[0][7] = -4.*zeta3;
+    dphi[0][8] = 4.*zeta3;
+    dphi[0][9] = 0.;
+
+    dphi[1][0] = v0;
+    dphi[1][1] = 0.;
+    dphi[1][2] = 4.*zeta2 - 1.;
+    dphi[1][3] = 0.;
+    dphi[1][4] = -4.*zeta1;
+    dphi[1][5] = 4.*zeta1;
+    dphi[1][6] = 4.*(zeta0 - zeta2);
+    dphi[1][7] = -4.*zeta3;
+    dphi[1][8] = 0.;
+    dphi[1][9] = 4.*zeta3;
+
+    dphi[2][0] = v0;
+    dphi[2][1] = 0.;
+    dphi[2][2] = 0.;
+    dphi[2][3] = 4.*zeta3 - 1.;
+    dphi[2][4] = -4.*zeta1;
+    dphi[2][5] = 0.;
+    dphi[2][6] = -4.*zeta2;
+    dphi[2][7] = 4.*(zeta0 - zeta3);
+    dphi[2][8] = 4.*zeta1;
+    dphi[2][9] = 4.*zeta2;
+  }
+};
+
+
+
+/**
+ * Evaluates every shape function of \p Kernel at every point in \p p,
+ * storing them in \p v[i][qp].
+ */
+template <typename Kernel>
+void lagrange_kernel_all_shapes (const std::vector<Point> & p,
+                                 std::vector<std::vector<Real>> & v)
+{
+  libmesh_assert_equal_to (v.size(), Kernel::n_shapes);
+
+  Real phi[Kernel::n_shapes];
+  for (auto qp : index_range(p))
+    {
+      Kernel::shapes(p[qp], phi);
+      for (unsigned int i = 0; i != Kernel::n_shapes; ++i)
+        v[i][qp] = phi[i];
+    }
+}
+
+/**
+ * Evaluates every first derivative of every shape function of \p
+ * Kernel at every point in \p p, storing the derivative with respect
+ * to master coordinate j in \p (*comps[j])[i][qp].
+ */
+template <typename Kernel>
+void lagrange_kernel_all_shape_derivs (const std::vector<Point> & p,
+                                       std::vector<std::vector<Real>> * comps[3])
+{
+  Real dphi[Kernel::dim][Kernel::n_shapes];
+  for (auto qp : index_range(p))
+    {
+      Kernel::shape_derivs(p[qp], dphi);
+      for (unsigned int j = 0; j != Kernel::dim; ++j)
+        {
+          std::vector<std::vector<Real>> & v = *comps[j];
+          libmesh_assert_equal_to (v.size(), Kernel::n_shapes);
+          for (unsigned int i = 0; i != Kernel::n_shapes; ++i)
+            v[i][qp] = dphi[j][i];
+        }
+    }
+}
+
+/**
+ * The fixed-size kernels available, by element type and total order.
+ */
+enum LagrangeKernelType
+  {
+    NO_LAGRANGE_KERNEL = 0,
+    LAGRANGE_TRI3_KERNEL,
+    LAGRANGE_TRI6_KERNEL,
+    LAGRANGE_QUAD4_KERNEL,
+    LAGRANGE_QUAD9_KERNEL,
+    LAGRANGE_TET4_KERNEL,
+    LAGRANGE_TET10_KERNEL,
+    LAGRANGE_HEX8_KERNEL,
+    LAGRANGE_HEX27_KERNEL
+  };
+
+/**
+ * \returns The kernel which evaluates Lagrange shape functions of
+ * total order \p order on elements of type \p type, or \p
+ * NO_LAGRANGE_KERNEL if the generic implementation has to be used.
+ */
+inline
+LagrangeKernelType lagrange_kernel_type (const ElemType type,
+                                         const Order order)
+{
+  switch (order)
+    {
+    case FIRST:
+      switch (type)
+        {
+        case TRI3:
+        case TRISHELL3:
+        case TRI6:
+          return LAGRANGE_TRI3_KERNEL;
+        case QUAD4:
+        case QUADSHELL4:
+        case QUAD8:
+        case QUADSHELL8:
+        case QUAD9:
+          return LAGRANGE_QUAD4_KERNEL;
+        case TET4:
+        case TET10:
+          return LAGRANGE_TET4_KERNEL;
+        case HEX8:
+        case HEX20:
+        case HEX27:
+          return LAGRANGE_HEX8_KERNEL;
+        default:
+          return NO_LAGRANGE_KERNEL;
+        }
+
+    case SECOND:
+      switch (type)
+        {
+        case TRI6:
+          return LAGRANGE_TRI6_KERNEL;
+        case QUAD9:
+          return LAGRANGE_QUAD9_KERNEL;
+        case TET10:
+          return LAGRANGE_TET10_KERNEL;
+        case HEX27:
+          return LAGRANGE_HEX27_KERNEL;
+        default:
+          return NO_LAGRANGE_KERNEL;
+        }
+
+    default:
+      return NO_LAGRANGE_KERNEL;
+    }
+}
+
+/**
+ * Fills \p v[i][qp] using the fixed-size kernel for elements of type \p type and total order \p order.
+ *
+ * \returns \p false, without touching \p v, if there is no such
+ * kernel.
+ */
+inline
+bool lagrange_kernel_all_shapes (const ElemType type,
+                                 const Order order,
+                                 const std::vector<Point> & p,
+                                 std::vector<std::vector<Real>> & v)
+{
+  switch (lagrange_kernel_type(type, order))
+    {
+    case LAGRANGE_TRI3_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeTri3Kernel>(p, v); return true;
+    case LAGRANGE_TRI6_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeTri6Kernel>(p, v); return true;
+    case LAGRANGE_QUAD4_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeQuad4Kernel>(p, v); return true;
+    case LAGRANGE_QUAD9_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeQuad9Kernel>(p, v); return true;
+    case LAGRANGE_TET4_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeTet4Kernel>(p, v); return true;
+    case LAGRANGE_TET10_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeTet10Kernel>(p, v); return true;
+    case LAGRANGE_HEX8_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeHex8Kernel>(p, v); return true;
+    case LAGRANGE_HEX27_KERNEL:
+      lagrange_kernel_all_shapes<LagrangeHex27Kernel>(p, v); return true;
+    default:
+      return false;
+    }
+}
+
+/**
+ * Fills \p (*comps[j])[i][qp] using the fixed-size kernel for
+ * elements of type \p type and total order \p order.
+ *
+ * \returns \p false, without touching \p comps, if there is no such
+ * kernel.
+ */
+inline
+bool lagrange_kernel_all_shape_derivs (const ElemType type,
+                                       const Order order,
+                                       const std::vector<Point> & p,
+                                       std::vector<std::vector<Real>> * comps[3])
+{
+  switch (lagrange_kernel_type(type, order))
+    {
+    case LAGRANGE_TRI3_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeTri3Kernel>(p, comps); return true;
+    case LAGRANGE_TRI6_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeTri6Kernel>(p, comps); return true;
+    case LAGRANGE_QUAD4_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeQuad4Kernel>(p, comps); return true;
+    case LAGRANGE_QUAD9_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeQuad9Kernel>(p, comps); return true;
+    case LAGRANGE_TET4_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeTet4Kernel>(p, comps); return true;
+    case LAGRANGE_TET10_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeTet10Kernel>(p, comps); return true;
+    case LAGRANGE_HEX8_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeHex8Kernel>(p, comps); return true;
+    case LAGRANGE_HEX27_KERNEL:
+      lagrange_kernel_all_shape_derivs<LagrangeHex27Kernel>(p, comps); return true;
+    default:
+      return false;
+    }
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_LAGRANGE_KERNELS_H
@@ -22,6 +22,7 @@
 
 // libMesh includes
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/aligned_array_2d.h"
 #include "libmesh/point.h"
 #include "libmesh/vector_value.h"
 #include "libmesh/fe_type.h"
@@ -227,6 +228,37 @@ public:
   { libmesh_assert(!calculations_started || calculate_dxyz);
     calculate_dxyz = true; return JxW; }
 
+  /**
+   * \returns The \p xyz spatial locations of the quadrature points,
+   * as a contiguous, aligned LIBMESH_DIM x n_qp array of coordinates
+   * indexed [component][qp].
+   *
+   * Contiguous copies are only made for the quantities which have
+   * been requested through the get_contiguous_*() accessors, after
+   * the map has been computed as usual.
+   */
+  const AlignedArray2D<Real> & get_contiguous_xyz() const
+  { libmesh_assert(!calculations_started || calculate_contiguous);
+    calculate_xyz = calculate_contiguous = true; return contiguous_xyz; }
+
+  /**
+   * \returns The element Jacobian times the quadrature weight, as a
+   * contiguous, aligned 1 x n_qp array.
+   */
+  const AlignedArray2D<Real> & get_contiguous_JxW() const
+  { libmesh_assert(!calculations_started || calculate_contiguous);
+    calculate_dxyz = calculate_contiguous = true; return contiguous_JxW; }
+
+  /**
+   * \returns The inverse map derivatives d(xi_j)/d(x_k) as a
+   * contiguous, aligned 9 x n_qp array indexed [3*j+k][qp]; e.g. row
+   * 0 holds dxidx and row 5 holds detadz.  Rows for master
+   * coordinates beyond the element dimension are zero.
+   */
+  const AlignedArray2D<Real> & get_contiguous_dxidxyz() const
+  { libmesh_assert(!calculations_started || calculate_contiguous);
+    calculate_dxyz = calculate_contiguous = true; return contiguous_dxidxyz; }
+
   /**
    * \returns The element tangents in xi-direction at the quadrature
    * points.
@@ -656,6 +688,14 @@ protected:
    */
   void resize_quadrature_map_vectors(const unsigned int dim, unsigned int n_qp);
 
+  /**
+   * A utility function for use by compute_*_map: copies whichever map
+   * data have been requested in contiguous form.  Inverse map
+   * derivatives are copied for the first \p dim master coordinates;
+   * side and edge maps, which do not compute them, pass 0.
+   */
+  void copy_to_contiguous(const unsigned int dim);
+
   /**
    * Used in \p FEMap::compute_map(), which should be
    * be usable in derived classes, and therefore protected.
@@ -993,6 +1033,14 @@ protected:
    */
   std::vector<Real> JxW;
 
+  /**
+   * Contiguous copies of xyz, JxW and the inverse map derivatives,
+   * made on request.
+   */
+  AlignedArray2D<Real> contiguous_xyz;
+  AlignedArray2D<Real> contiguous_JxW;
+  AlignedArray2D<Real> contiguous_dxidxyz;
+
   /**
    * Have calculations with this object already been started?
    * Then all get_* functions should already have been called.
@@ -1018,6 +1066,11 @@ protected:
 
 #endif
 
+  /**
+   * Should we make contiguous copies of the map data?
+   */
+  mutable bool calculate_contiguous;
+
   /**
    * The Jacobian tolerance used for determining when the mapping fails. The mapping is
    * determined to fail if jac <= jacobian_tolerance. If not set by the user, this number
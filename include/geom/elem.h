@@ -34,6 +34,7 @@
 #include "libmesh/simple_range.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/hashword.h" // Used in compute_key() functions
+#include "libmesh/object_pool.h"
 
 #ifdef LIBMESH_FORWARD_DECLARE_ENUMS
 namespace libMesh
@@ -138,6 +139,18 @@ public:
    */
   virtual ~Elem();
 
+  /**
+   * Class-specific allocation functions.  Elements are allocated from
+   * the \p ObjectPool, which recycles their storage when pooling has
+   * been enabled.  Because the destructor is virtual, the sized
+   * deallocation function receives the size of the most derived type.
+   */
+  static void * operator new (std::size_t size)
+  { return ObjectPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { ObjectPool::deallocate(p, size); }
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
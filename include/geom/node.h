@@ -25,6 +25,7 @@
 #include "libmesh/dof_object.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
+#include "libmesh/object_pool.h"
 
 // C++ includes
 #include <iostream>
@@ -100,6 +101,16 @@ public:
    */
   ~Node ();
 
+  /**
+   * Class-specific allocation functions, drawing nodes from the
+   * \p ObjectPool when pooling has been enabled.
+   */
+  static void * operator new (std::size_t size)
+  { return ObjectPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { ObjectPool::deallocate(p, size); }
+
   /**
    * Assign to a node from a point.
    */
@@ -0,0 +1,153 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SIMPLEX_CUTTER_H
+#define LIBMESH_SIMPLEX_CUTTER_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/point.h"
+#include "libmesh/enum_elem_type.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class QBase;
+
+/**
+ * This class cuts a single element by the zero level set of a signed
+ * distance function, much like the \p ElemCutter, but without any
+ * external mesh generator.  The element is split into simplices
+ * (Edge, Tri or Tet) through its vertices, on which the distance
+ * function is interpolated linearly, and each simplex is cut by the
+ * resulting planar interface into simplices on either side of it
+ * ("marching simplices").  Higher order geometry is ignored, so
+ * this is intended to be used on reference elements.
+ *
+ * The pieces are kept as lists of vertices, from which composite
+ * quadrature rules are built directly by \p add_quadrature(); no
+ * \p Elem or \p Mesh objects are ever created.  Separate objects can
+ * safely be used on separate threads.
+ *
+ * \date 2021
+ * \brief Subdivides a single element by marching simplices.
+ */
+class SimplexCutter
+{
+public:
+
+  SimplexCutter ();
+
+  /**
+   * \returns \p true if the element is cut by the interface defined
+   * implicitly by the vertex values of the signed
+   * \p vertex_distance_func, i.e. if those change sign.
+   */
+  bool is_cut (const Elem & elem,
+               const std::vector<Real> & vertex_distance_func) const;
+
+  /**
+   * Cuts \p elem by the zero level set of the signed distance
+   * function whose vertex values are \p vertex_distance_func.
+   * Negative values are inside the cutting surface.  Any previous
+   * pieces are discarded.
+   */
+  void operator() (const Elem & elem,
+                   const std::vector<Real> & vertex_distance_func);
+
+  /**
+   * \returns The type of the pieces: \p EDGE2, \p TRI3 or \p TET4.
+   */
+  ElemType simplex_type () const;
+
+  /**
+   * \returns The number of pieces inside the cutting surface.
+   */
+  unsigned int n_inside_simplices () const
+  { return cast_int<unsigned int>(_inside_vertices.size() / (_dim + 1)); }
+
+  /**
+   * \returns The number of pieces outside the cutting surface.
+   */
+  unsigned int n_outside_simplices () const
+  { return cast_int<unsigned int>(_outside_vertices.size() / (_dim + 1)); }
+
+  /**
+   * \returns The vertices of the pieces inside the cutting surface,
+   * \p dim+1 consecutive entries per piece.
+   */
+  const std::vector<Point> & inside_vertices () const
+  { return _inside_vertices; }
+
+  /**
+   * \returns The vertices of the pieces outside the cutting surface,
+   * \p dim+1 consecutive entries per piece.
+   */
+  const std::vector<Point> & outside_vertices () const
+  { return _outside_vertices; }
+
+  /**
+   * Maps \p simplex_rule, which must have been initialized on a
+   * \p simplex_type() element, onto each of the \p inside (or
+   * outside) pieces, appending the resulting points and weights to
+   * \p points and \p weights.  Reusing the same vectors from element
+   * to element avoids any reallocation.
+   */
+  void add_quadrature (const QBase & simplex_rule,
+                       bool inside,
+                       std::vector<Point> & points,
+                       std::vector<Real> & weights) const;
+
+private:
+
+  /**
+   * Cuts the simplex with vertices \p v and distance values \p phi,
+   * appending its pieces to the inside and outside lists.
+   */
+  void cut_simplex (const Point * v, const Real * phi);
+
+  /**
+   * Appends a piece with vertices \p v to the inside or outside list.
+   */
+  void add_simplex (const Point * v, bool inside);
+
+  /**
+   * Cuts the prism with vertices \p v, which lies entirely on one
+   * side, into three tetrahedra.
+   */
+  void add_prism (const Point * v, bool inside);
+
+  /**
+   * The dimension of the element being cut.
+   */
+  unsigned int _dim;
+
+  std::vector<Point> _inside_vertices;
+  std::vector<Point> _outside_vertices;
+};
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_SIMPLEX_CUTTER_H
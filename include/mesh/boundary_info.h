@@ -594,14 +594,28 @@ public:
    * functions, we're using tuples.
    *
    * The "sort_by" parameter controls how the resulting list of tuples
-   * is sorted.  It is possible (but not recommended) to choose
-   * UNSORTED, since in that case the resulting vectors will
-   * potentially be in different orders on different procs.
+   * is sorted.  Every ordering is a stable sort of \p
+   * sorted_node_list(), so the result is the same on all procs; with
+   * UNSORTED no further sorting is done.
    */
   typedef std::tuple<dof_id_type, boundary_id_type> NodeBCTuple;
   enum class NodeBCTupleSortBy {NODE_ID, BOUNDARY_ID, UNSORTED};
   std::vector<NodeBCTuple> build_node_list(NodeBCTupleSortBy sort_by = NodeBCTupleSortBy::NODE_ID) const;
 
+  /**
+   * As above, but fills \p bc_tuples, reusing its storage.
+   */
+  void build_node_list(std::vector<NodeBCTuple> & bc_tuples,
+                       NodeBCTupleSortBy sort_by = NodeBCTupleSortBy::NODE_ID) const;
+
+  /**
+   * \returns The (node-id, bc-id) list sorted by node id.  The list
+   * is cached, and only rebuilt (with a threaded sort) after the
+   * boundary ids or the mesh have changed, so calling this every time
+   * step is cheap.
+   */
+  const std::vector<NodeBCTuple> & sorted_node_list() const;
+
   /**
    * Adds nodes with boundary ids based on the side's boundary
    * ids they are connected to.
@@ -637,14 +651,28 @@ public:
    *
    * The returned vector is sorted by element id by default, but this
    * can be changed by passing SIDE_ID, BOUNDARY_ID, or UNSORTED to
-   * this function. Note: choosing UNSORTED is not recommended since
-   * the resulting list will potentially be in different orders on
-   * different processors when running in parallel.
+   * this function.  Every ordering is a stable sort of \p
+   * sorted_side_list(), so the result is the same on all procs; with
+   * UNSORTED no further sorting is done.
    */
   typedef std::tuple<dof_id_type, unsigned short int, boundary_id_type> BCTuple;
   enum class BCTupleSortBy {ELEM_ID, SIDE_ID, BOUNDARY_ID, UNSORTED};
   std::vector<BCTuple> build_side_list(BCTupleSortBy sort_by = BCTupleSortBy::ELEM_ID) const;
 
+  /**
+   * As above, but fills \p bc_triples, reusing its storage.
+   */
+  void build_side_list(std::vector<BCTuple> & bc_triples,
+                       BCTupleSortBy sort_by = BCTupleSortBy::ELEM_ID) const;
+
+  /**
+   * \returns The (elem-id, side-id, bc-id) list sorted by element
+   * id, then side and boundary id.  The list is cached, and only
+   * rebuilt (with a threaded sort) after the boundary ids or the mesh
+   * have changed, so calling this every time step is cheap.
+   */
+  const std::vector<BCTuple> & sorted_side_list() const;
+
   /**
    * Creates a list of active element numbers, sides, and ids for those sides.
    *
@@ -881,11 +909,27 @@ private:
                       std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
                       const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Marks the cached sorted node and side lists as out of date, and
+   * records the boundary change with the mesh.
+   */
+  void _invalidate_cached_lists();
+
   /**
    * The Mesh this boundary info pertains to.
    */
   MeshBase & _mesh;
 
+  /**
+   * The cached results of \p sorted_node_list() and \p
+   * sorted_side_list(), whether they are up to date with our id maps,
+   * and the \p MeshBase::modification_count() they were built at.
+   */
+  mutable std::vector<NodeBCTuple> _sorted_node_list;
+  mutable std::vector<BCTuple> _sorted_side_list;
+  mutable bool _sorted_node_list_valid, _sorted_side_list_valid;
+  mutable std::size_t _sorted_node_list_stamp, _sorted_side_list_stamp;
+
   /**
    * Data structure that maps nodes in the mesh
    * to boundary ids.
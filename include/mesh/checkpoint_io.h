@@ -175,6 +175,9 @@ public:
    * This is used for m->n parallel checkpoint file writing:
    * You can force CheckpointIO to write out different partitions of a
    * mesh by setting which partitions to write from each processor here.
+   * A distributed mesh writing partitions other than its own must
+   * have every element of those partitions, and everything their
+   * ghosting functors require, on the writing processor.
    */
   const std::vector<processor_id_type> & current_processor_ids() const { return _my_processor_ids; }
   std::vector<processor_id_type> & current_processor_ids() { return _my_processor_ids; }
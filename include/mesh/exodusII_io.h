@@ -234,6 +234,15 @@ public:
    const std::set<std::string> * system_names = nullptr,
    const std::string & var_suffix = "_elem_node_");
 
+  /**
+   * Writes out the nodal solution of \p es.  If a write chunk size
+   * has been set, the solution is written from a parallel vector
+   * instead of a serialized copy; see \p set_write_chunk_size().
+   */
+  virtual void write_equation_systems (const std::string & fname,
+                                       const EquationSystems & es,
+                                       const std::set<std::string> * system_names=nullptr) override;
+
   /**
    * Bring in base class functionality for name resolution and to
    * avoid warnings about hidden overloaded virtual functions.
@@ -248,6 +257,17 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * Write out a nodal solution from a parallel, node-major vector.
+   * If a write chunk size has been set, each variable is gathered
+   * onto processor 0 and written one chunk of nodes at a time, so
+   * that no processor ever holds more than one chunk of values.
+   * Otherwise the vector is localized and written as above.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
   /**
    * Write out a discontinuous nodal solution.
    */
@@ -361,6 +381,19 @@ public:
   void set_output_variables(const std::vector<std::string> & output_variables,
                             bool allow_empty = true);
 
+  /**
+   * Sets the maximum number of nodes whose values of a single
+   * variable are gathered and written at once by
+   * \p write_equation_systems() and \p write_timestep().  Large
+   * transient runs can use this to bound the memory used for output,
+   * which otherwise requires the whole nodal solution, for every
+   * variable, on processor 0.  The default, 0, disables chunking.
+   *
+   * \note The node numbering must be contiguous, as it always is
+   * when renumbering is allowed.
+   */
+  void set_write_chunk_size(dof_id_type n_nodes);
+
   /**
    * In the general case, meshes containing 2D elements can be
    * manifolds living in 3D space, thus by default we write all
@@ -488,6 +521,12 @@ private:
    */
   bool _allow_empty_variables;
 
+  /**
+   * The maximum number of nodes written at once, or 0 to write all
+   * the values of each variable at once.
+   */
+  dof_id_type _write_chunk_size;
+
   /**
    * By default, when complex numbers are enabled, for each variable
    * we write out three values: the real part, "r_u" the imaginary
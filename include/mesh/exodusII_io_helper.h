@@ -417,6 +417,16 @@ public:
    */
   void write_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
 
+  /**
+   * Writes the vector of values to a nodal variable, for the
+   * consecutive nodes starting at the (zero-based) \p first_node.
+   * Buffers are flushed once the last node has been written.
+   */
+  void write_partial_nodal_values(int var_id,
+                                  dof_id_type first_node,
+                                  const std::vector<Real> & values,
+                                  int timestep);
+
   /**
    * Writes the vector of information records.
    */
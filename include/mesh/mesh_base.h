@@ -157,7 +157,77 @@ public:
    * Tells this we have done some operation where we should no longer consider ourself prepared
    */
   void set_isnt_prepared()
-  { _is_prepared = false; }
+  { this->record_modification(ALL_CHANGED); _is_prepared = false; }
+
+  /**
+   * Kinds of modification a mesh can undergo after it has been
+   * prepared.  Each invalidates a different subset of the work done
+   * in \p prepare_for_use().
+   */
+  enum ModificationType : unsigned char
+  {
+    /**
+     * Elements or nodes were added, deleted, renumbered or reconnected.
+     */
+    TOPOLOGY_CHANGED = 1,
+    /**
+     * Nodes were moved.
+     */
+    GEOMETRY_CHANGED = 2,
+    /**
+     * Subdomain ids or other element and node metadata were changed.
+     */
+    IDS_CHANGED = 4,
+    /**
+     * Boundary ids were added, removed or changed.
+     */
+    BOUNDARY_CHANGED = 8,
+    ALL_CHANGED = 15
+  };
+
+  /**
+   * Declares that the mesh has undergone the modifications in the
+   * bitmask \p modifications since it was last prepared, in addition
+   * to those recorded automatically, so that the next call to \p
+   * prepare_for_use() only repeats the phases they invalidate.
+   *
+   * Adding, inserting, deleting and renumbering elements or nodes,
+   * changing boundary ids through \p BoundaryInfo, and moving nodes
+   * or changing subdomain ids with the \p MeshTools::Modification
+   * functions are recorded automatically; moving nodes or changing
+   * ids directly is not.  Since the library can't tell whether the
+   * automatic record is complete, \p prepare_for_use() only skips
+   * phases once the user has called this method, possibly with no
+   * further modifications, to declare that it is.
+   */
+  void set_modified (unsigned char modifications)
+  {
+    this->record_modification(modifications);
+    _modifications_declared = true;
+  }
+
+  /**
+   * Records the modifications in the bitmask \p modifications, made
+   * by a library mutator.  Unlike \p set_modified() this makes no
+   * claim that the record is complete.
+   */
+  void record_modification (unsigned char modifications)
+  { _modifications |= modifications; ++_modification_count; }
+
+  /**
+   * \returns The bitmask of \p ModificationType values recorded
+   * since the mesh was last prepared.
+   */
+  unsigned char modifications () const
+  { return _modifications; }
+
+  /**
+   * \returns A counter which is incremented whenever a modification
+   * is recorded, and which is never reset, so that data derived from
+   * the mesh can be cached along with the count it was computed at.
+   */
+  std::size_t modification_count () const
+  { return _modification_count; }
 
   /**
    * \returns \p true if all elements and nodes of the mesh
@@ -998,6 +1068,14 @@ public:
    *  3.) call \p renumber_nodes_and_elements()
    *  4.) call \p cache_elem_dims()
    *
+   * On a mesh which has been prepared before, only the steps
+   * invalidated by the modifications recorded since then are
+   * repeated, provided the user has declared that record complete via
+   * \p set_modified(); e.g. moving nodes only refreshes cached
+   * dimensions and the point locator, and changing subdomain or
+   * boundary ids only reinitializes ghosting functors.  Otherwise, or
+   * if no modification has been recorded, every step is repeated.
+   *
    * The argument to skip renumbering is now deprecated - to prevent a
    * mesh from being renumbered, set allow_renumbering(false). The argument to skip
    * finding neighbors is also deprecated. To prevent find_neighbors, set
@@ -1758,6 +1836,23 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * Bitmask of the \p ModificationType values recorded since the
+   * mesh was last prepared.
+   */
+  unsigned char _modifications;
+
+  /**
+   * Flag set by \p set_modified(), when the user has declared the
+   * recorded modifications to be complete.
+   */
+  bool _modifications_declared;
+
+  /**
+   * The number of modifications ever recorded.
+   */
+  std::size_t _modification_count;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -0,0 +1,180 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MESH_FIELD_SNAPSHOT_H
+#define LIBMESH_MESH_FIELD_SNAPSHOT_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class DofObject;
+class MeshBase;
+
+/**
+ * This class takes a snapshot of named extra integer and \p Real
+ * fields of the active local elements (or the local nodes) of a mesh,
+ * in columns: one contiguous array per field, with entry \p i
+ * belonging to \p object(i).  Reading or writing one field across
+ * the whole mesh then streams through a single array, rather than
+ * visiting the separately allocated index buffer of every
+ * \p DofObject.
+ *
+ * The snapshot is a copy.  The fields live in the mesh's extra
+ * integers and data (see \p MeshBase::add_elem_integer() and
+ * \p MeshBase::add_elem_datum()), which the mesh keeps consistent
+ * through renumbering, redistribution, refinement and checkpointing;
+ * the snapshot is not updated by any of those.  \p gather() copies
+ * every field into the columns in a single threaded pass over the
+ * objects, and \p scatter() copies them back.
+ *
+ * The snapshot holds pointers to the objects it was gathered from,
+ * so it becomes stale as soon as the mesh records any modification
+ * (see \p MeshBase::modification_count()), and then has to be
+ * gathered again before it is used.  Adding a field invalidates
+ * references to the existing columns.
+ *
+ * \date 2021
+ * \brief A columnar snapshot of extra integer and real fields of a mesh.
+ */
+class MeshFieldSnapshot
+{
+public:
+
+  /**
+   * Constructor.  The columns will hold values of the active local
+   * elements of \p mesh, or of its local nodes if \p nodes is true.
+   */
+  MeshFieldSnapshot (MeshBase & mesh, bool nodes = false);
+
+  /**
+   * Adds a column for the extra integer \p name, which is added to
+   * the mesh, with \p DofObject::invalid_id values, if it does not
+   * exist yet.  If the snapshot has already been gathered, the new
+   * column is gathered from the same objects immediately, which is an
+   * error if the snapshot is stale.
+   */
+  void add_integer_field (const std::string & name);
+
+  /**
+   * Adds a column for the \p Real datum \p name, which is added to
+   * the mesh if it does not exist yet.  If the snapshot has already
+   * been gathered, the new column is gathered immediately, which is
+   * an error if the snapshot is stale.
+   */
+  void add_real_field (const std::string & name);
+
+  /**
+   * Copies the fields of every active local element (or local node)
+   * of the mesh into the columns, resizing them as necessary.
+   */
+  void gather ();
+
+  /**
+   * Copies the columns back into the objects they were gathered from.
+   * It is an error to scatter a stale snapshot.
+   */
+  void scatter () const;
+
+  /**
+   * \returns \p true if the mesh has recorded a modification since
+   * the snapshot was gathered, so that the objects it was gathered
+   * from may no longer exist.
+   */
+  bool stale () const;
+
+  /**
+   * \returns The number of objects, i.e. the length of every column.
+   */
+  std::size_t size () const { return _objects.size(); }
+
+  /**
+   * \returns The object whose values are at entry \p i of the columns.
+   * It is an error to call this on a stale snapshot.
+   */
+  const DofObject & object (std::size_t i) const;
+
+  /**
+   * \returns The column of the extra integer \p name.
+   */
+  std::vector<dof_id_type> & integer_column (const std::string & name);
+  const std::vector<dof_id_type> & integer_column (const std::string & name) const;
+
+  /**
+   * \returns The column of the \p Real datum \p name.
+   */
+  std::vector<Real> & real_column (const std::string & name);
+  const std::vector<Real> & real_column (const std::string & name) const;
+
+private:
+
+  /**
+   * \returns The position of \p name in \p names.
+   */
+  static std::size_t field_position (const std::map<std::string, std::size_t> & names,
+                                     const std::string & name);
+
+  /**
+   * Throws an error if the snapshot is stale.
+   */
+  void check_not_stale () const;
+
+  MeshBase & _mesh;
+
+  /**
+   * The \p MeshBase::modification_count() at the last \p gather().
+   */
+  std::size_t _mesh_stamp;
+
+  /**
+   * Whether the columns hold node rather than element values.
+   */
+  const bool _nodes;
+
+  /**
+   * The objects the columns were gathered from, in the order of the
+   * mesh's iterators.
+   */
+  std::vector<DofObject *> _objects;
+
+  /**
+   * The positions of the fields in the vectors below, by name.
+   */
+  std::map<std::string, std::size_t> _integer_names, _real_names;
+
+  /**
+   * The extra integer indices of the fields, and their columns.
+   */
+  std::vector<unsigned int> _integer_indices, _real_indices;
+  std::vector<std::vector<dof_id_type>> _integer_columns;
+  std::vector<std::vector<Real>> _real_columns;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_FIELD_SNAPSHOT_H
@@ -65,6 +65,12 @@ class QueryElemSubdomainIDBase;
  *
  * Boundary ids are set to be equal to the side indexing on a
  * master hex
+ *
+ * On a distributed mesh which is allowed to delete remote elements,
+ * each processor builds only a contiguous block of the grid plus
+ * one layer of ghost elements, with globally consistent ids and
+ * unique_ids, so no processor ever holds the whole mesh.  The mesh
+ * is then partitioned as usual by prepare_for_use().
  */
 void build_cube (UnstructuredMesh & mesh,
                  const unsigned int nx=0,
@@ -550,6 +550,12 @@ private:
 
   //------------------------------------------------------
   // "Smoothing" algorithms for refined meshes
+  //
+  // Each of these returns \p true if it changed any flags on this
+  // processor; _smooth_flags() combines their results in a single
+  // global reduction per round.  The nodal and edge mismatch limits
+  // and the patch elimination sweep the active elements with
+  // multiple threads.
 
   /**
    * This algorithm restricts the maximum level mismatch
@@ -743,6 +749,14 @@ private:
                                  const PointLocatorBase * point_locator,
                                  const Elem * neighbor) const;
 
+  /**
+   * Appends the active elements which share a side with \p elem to
+   * \p neighbors, for revisiting after the flags of \p elem change.
+   */
+  void append_active_neighbors (Elem * elem,
+                                const PointLocatorBase * point_locator,
+                                std::vector<Elem *> & neighbors) const;
+
   /**
    * Data structure that holds the new nodes information.
    */
@@ -855,20 +869,6 @@ private:
    */
   bool _enforce_mismatch_limit_prior_to_refinement;
 
-  /**
-   * This helper function enforces the desired mismatch limits prior
-   * to refinement.  It is called from the
-   * MeshRefinement::limit_level_mismatch_at_edge() and
-   * MeshRefinement::limit_level_mismatch_at_node() functions.
-   *
-   * \returns \p true if this enforcement caused the refinement flags for
-   * \p elem to change, false otherwise.
-   */
-  enum NeighborType {POINT, EDGE};
-  bool enforce_mismatch_limit_prior_to_refinement(Elem * elem,
-                                                  NeighborType nt,
-                                                  unsigned max_mismatch);
-
 #ifdef LIBMESH_ENABLE_PERIODIC
   PeriodicBoundaries * _periodic_boundaries;
 #endif
@@ -28,6 +28,9 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <map>
+#include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -45,6 +48,13 @@ class System;
  * of files the Mesh is split into and rank is the ID of the processor's
  * elements that were written to the file.
  *
+ * By default one file per processor is expected.  A mesh split into
+ * a different number of files can be read after calling \p
+ * set_n_files(), in which case each processor reads some of the
+ * files, or part of one.  The resulting mesh is not yet well
+ * partitioned; like any other mesh it is repartitioned, and
+ * redistributed, by \p prepare_for_use().
+ *
  * \author John Peterson
  * \date 2008
  */
@@ -70,10 +80,26 @@ public:
   /**
    * Implements reading the mesh from several different files.
    * You provide the basename, then LibMesh appends the ".size.rank"
-   * depending on this->n_processors() and this->processor_id().
+   * depending on this->n_processors() and this->processor_id(), or
+   * on the number of files set by \p set_n_files().
    */
   virtual void read (const std::string & base_filename) override;
 
+  /**
+   * Sets the number of files, i.e. the "size" in ".size.rank", to
+   * read a mesh from.  Defaults to the number of processors.
+   *
+   * With more files than processors, each processor reads a
+   * contiguous range of them; with fewer, each file is read by a
+   * contiguous range of processors, each of which keeps a share of
+   * its elements.  Element and node ids are those stored in the
+   * files, and no processor ever holds more than its own files'
+   * parts of the mesh.  Nodal and elemental solutions are copied by
+   * \p copy_nodal_solution() and \p copy_elemental_solution() as
+   * usual, even after the mesh has been redistributed.
+   */
+  void set_n_files (processor_id_type n_files);
+
   /**
    * This method implements writing a mesh to a specified file.
    */
@@ -213,8 +239,45 @@ private:
   void assert_symmetric_cmaps();
 
 #if defined(LIBMESH_HAVE_EXODUS_API) && defined(LIBMESH_HAVE_NEMESIS_API)
+  /**
+   * Implements read() when the number of files differs from the
+   * number of processors.
+   */
+  void read_n_files (const std::string & base_filename);
+
+  /**
+   * \returns True if the files read were not one per processor.
+   */
+  bool reading_n_files () const
+  { return _n_files && _n_files != this->n_processors(); }
+
+  /**
+   * Reads the values of \p exodus_var_name for every node (if \p
+   * nodal) or element of every file we read, and fills \p values
+   * with those of the ids in \p ids, wherever they were read.
+   */
+  void gather_var_values (const std::string & exodus_var_name,
+                          unsigned int timestep,
+                          bool nodal,
+                          const std::vector<dof_id_type> & ids,
+                          std::map<dof_id_type, Real> & values);
+
   std::unique_ptr<Nemesis_IO_Helper> nemhelper;
 
+  /**
+   * Helpers for the files read in addition to the one read by \p
+   * nemhelper, kept open for reading solutions.
+   */
+  std::vector<std::unique_ptr<Nemesis_IO_Helper>> _file_helpers;
+
+  /**
+   * Which share of its file this processor read, when files are
+   * split between processors, or 0.
+   */
+  processor_id_type _file_chunk;
+
+  bool _single_precision;
+
   /**
    * Keeps track of the current timestep index being written. Used
    * when calling write_nodal_data() and other functions.
@@ -222,6 +285,11 @@ private:
   int _timestep;
 #endif
 
+  /**
+   * The number of files to read, or 0 for one per processor.
+   */
+  processor_id_type _n_files;
+
   /**
    * Controls whether extra debugging information is printed to the screen or not.
    */
@@ -370,6 +370,14 @@ public:
    */
   std::string construct_nemesis_filename(const std::string & base_filename);
 
+  /**
+   * Given base_filename, foo.e, constructs the Nemesis filename
+   * foo.e.X.Y, where X=n_files and Y=file_id
+   */
+  static std::string construct_nemesis_filename(const std::string & base_filename,
+                                                processor_id_type n_files,
+                                                processor_id_type file_id);
+
   /**
    * Member data
    */
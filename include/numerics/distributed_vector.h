@@ -33,6 +33,8 @@
 #include <vector>
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <tuple>
 
 namespace libMesh
 {
@@ -46,6 +48,11 @@ namespace libMesh
  * processor. All overridden virtual functions are documented in
  * numeric_vector.h.
  *
+ * A \p GHOSTED vector additionally stores copies of the off-processor
+ * entries given to \p init(); these are refreshed by \p close() and
+ * by localizing into the vector, both of which only exchange the
+ * ghost values with the processors that own or need them.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  */
@@ -81,7 +88,8 @@ public:
   /**
    * Constructor. Set local dimension to \p n_local, the global
    * dimension to \p n, but additionally reserve memory for the
-   * indices specified by the \p ghost argument.
+   * indices specified by the \p ghost argument.  Ghost storage is only
+   * used if \p ptype is \p GHOSTED.
    */
   DistributedVector (const Parallel::Communicator & comm,
                      const numeric_index_type N,
@@ -95,6 +103,11 @@ public:
    * compiler-generated default attempts to automatically call the
    * base class (NumericVector) copy assignment operator, which we
    * have chosen to make pure virtual for other design reasons.
+   *
+   * An initialized vector keeps its own type and ghost list, and
+   * only takes the values of the (equally partitioned) argument;
+   * a GHOSTED vector then refreshes its ghost values, so this must
+   * be called on all processors at once.
    */
   DistributedVector & operator= (const DistributedVector &);
 
@@ -255,6 +268,48 @@ private:
    * The last component (+1) stored locally.
    */
   numeric_index_type _last_local_index;
+
+  /**
+   * The processors exchanging ghost values with this one, and what
+   * is exchanged with each.  Built once per ghosted \p init() and
+   * shared by vectors initialized from each other, e.g. by \p clone().
+   */
+  struct GhostPattern
+  {
+    /**
+     * For each processor ghosting some of our entries, the offsets
+     * of those entries in \p _values.
+     */
+    std::vector<std::pair<processor_id_type, std::vector<numeric_index_type>>> send;
+
+    /**
+     * For each processor owning some of our ghost entries, the
+     * contiguous range of \p _ghost_values holding them.
+     */
+    std::vector<std::tuple<processor_id_type, numeric_index_type, numeric_index_type>> receive;
+  };
+
+  /**
+   * Sorted global indices of the ghost entries.
+   */
+  std::vector<numeric_index_type> _ghost_indices;
+
+  /**
+   * Copies of the ghost entries, in the order of \p _ghost_indices.
+   */
+  std::vector<T> _ghost_values;
+
+  /**
+   * The ghost communication pattern, or nullptr if the vector is not
+   * \p GHOSTED.
+   */
+  std::shared_ptr<const GhostPattern> _ghost_pattern;
+
+  /**
+   * Refreshes \p _ghost_values from the owning processors, using
+   * nonblocking point-to-point messages between neighbors only.
+   */
+  void update_ghosts ();
 };
 
 
@@ -340,7 +395,8 @@ void DistributedVector<T>::init (const numeric_index_type n,
     this->_type = ptype;
 
   libmesh_assert ((this->_type==SERIAL && n==n_local) ||
-                  this->_type==PARALLEL);
+                  this->_type==PARALLEL ||
+                  this->_type==GHOSTED);
 
   // Clear the data structures if already initialized
   if (this->initialized())
@@ -397,27 +453,22 @@ void DistributedVector<T>::init (const numeric_index_type n,
 }
 
 
-template <typename T>
-inline
-void DistributedVector<T>::init (const numeric_index_type n,
-                                 const numeric_index_type n_local,
-                                 const std::vector<numeric_index_type> & /*ghost*/,
-                                 const bool fast,
-                                 const ParallelType ptype)
-{
-  // TODO: we shouldn't ignore the ghost sparsity pattern
-  this->init(n, n_local, fast, ptype);
-}
-
-
-
-/* Default implementation for solver packages for which ghosted
-   vectors are not yet implemented.  */
 template <class T>
 void DistributedVector<T>::init (const NumericVector<T> & other,
                                  const bool fast)
 {
+  const DistributedVector<T> * v = dynamic_cast<const DistributedVector<T> *>(&other);
+
   this->init(other.size(),other.local_size(),fast,other.type());
+
+  // Reuse the ghost pattern of another ghosted DistributedVector
+  // rather than rebuilding it.
+  if (v && v->_ghost_pattern && this->type() == GHOSTED)
+    {
+      _ghost_indices = v->_ghost_indices;
+      _ghost_values.resize(_ghost_indices.size());
+      _ghost_pattern = v->_ghost_pattern;
+    }
 }
 
 
@@ -439,6 +490,9 @@ void DistributedVector<T>::close ()
 {
   libmesh_assert (this->initialized());
 
+  if (this->type() == GHOSTED)
+    this->update_ghosts();
+
   this->_is_closed = true;
 }
 
@@ -449,6 +503,9 @@ inline
 void DistributedVector<T>::clear ()
 {
   _values.clear();
+  _ghost_indices.clear();
+  _ghost_values.clear();
+  _ghost_pattern.reset();
 
   _global_size =
     _local_size =
@@ -472,6 +529,10 @@ void DistributedVector<T>::zero ()
   std::fill (_values.begin(),
              _values.end(),
              0.);
+
+  std::fill (_ghost_values.begin(),
+             _ghost_values.end(),
+             0.);
 }
 
 
@@ -558,10 +619,17 @@ T DistributedVector<T>::operator() (const numeric_index_type i) const
   libmesh_assert (this->initialized());
   libmesh_assert_equal_to (_values.size(), _local_size);
   libmesh_assert_equal_to ((_last_local_index - _first_local_index), _local_size);
-  libmesh_assert ( ((i >= first_local_index()) &&
-                    (i <  last_local_index())) );
 
-  return _values[i - _first_local_index];
+  if (i >= _first_local_index && i < _last_local_index)
+    return _values[i - _first_local_index];
+
+  // Otherwise this had better be one of our ghost entries
+  libmesh_assert_equal_to (this->type(), GHOSTED);
+  const auto it = std::lower_bound(_ghost_indices.begin(),
+                                   _ghost_indices.end(), i);
+  libmesh_assert (it != _ghost_indices.end() && *it == i);
+
+  return _ghost_values[std::distance(_ghost_indices.begin(), it)];
 }
 
 
@@ -650,6 +718,8 @@ template <typename T>
 inline
 void DistributedVector<T>::swap (NumericVector<T> & other)
 {
+  NumericVector<T>::swap(other);
+
   DistributedVector<T> & v = cast_ref<DistributedVector<T> &>(other);
 
   std::swap(_global_size, v._global_size);
@@ -659,6 +729,9 @@ void DistributedVector<T>::swap (NumericVector<T> & other)
 
   // This should be O(1) with any reasonable STL implementation
   std::swap(_values, v._values);
+  std::swap(_ghost_indices, v._ghost_indices);
+  std::swap(_ghost_values, v._ghost_values);
+  std::swap(_ghost_pattern, v._ghost_pattern);
 }
 
 template <typename T>
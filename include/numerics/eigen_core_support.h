@@ -77,6 +77,18 @@ typedef int32_t eigen_idx_type;
 // We have to use RowMajor SparseMatrix storage for our preallocation to work
 typedef Eigen::SparseMatrix<Number, Eigen::RowMajor, eigen_idx_type> EigenSM;
 typedef Eigen::Matrix<Number, Eigen::Dynamic, 1> EigenSV;
+
+// Single precision storage, for matrices which are only needed
+// approximately, e.g. to build preconditioners from
+#ifdef LIBMESH_USE_COMPLEX_NUMBERS
+typedef std::complex<float> EigenReducedScalar;
+#else
+typedef float EigenReducedScalar;
+#endif
+typedef Eigen::SparseMatrix<EigenReducedScalar, Eigen::RowMajor, eigen_idx_type> EigenReducedSM;
+
+// Forward declarations
+template <typename T, typename S = T> class EigenSparseMatrix;
 } // namespace libMesh
 
 
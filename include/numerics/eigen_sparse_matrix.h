@@ -33,6 +33,8 @@
 // C++ includes
 #include <algorithm>
 #include <cstddef>
+#include <tuple>
+#include <vector>
 
 namespace libMesh
 {
@@ -41,16 +43,20 @@ namespace libMesh
 template <typename T> class DenseMatrix;
 template <typename T> class EigenSparseVector;
 template <typename T> class EigenSparseLinearSolver;
+template <typename T> class GeometricMultigridPreconditioner;
 
 /**
  * The EigenSparseMatrix class wraps a sparse matrix object from the
  * Eigen library. All overridden virtual functions are documented in
  * sparse_matrix.h.
  *
+ * Values of type \p T are stored as type \p S, which defaults to
+ * \p T; see \p EigenReducedPrecisionMatrix below.
+ *
  * \author Benjamin S. Kirk
  * \date 2013
  */
-template <typename T>
+template <typename T, typename S>
 class EigenSparseMatrix final : public SparseMatrix<T>
 {
 
@@ -80,8 +86,26 @@ public:
   /**
    * Convenient typedefs
    */
-  typedef EigenSM DataType;
-  typedef Eigen::Triplet<T,eigen_idx_type> TripletType;
+  typedef Eigen::SparseMatrix<S, Eigen::RowMajor, eigen_idx_type> DataType;
+  typedef S ValueType;
+  typedef Eigen::Triplet<S,eigen_idx_type> TripletType;
+
+  /**
+   * The \p EigenSparseMatrix uses the full sparsity pattern, when
+   * one is available, to build a fixed compressed row structure up
+   * front.
+   */
+  virtual bool need_full_sparsity_pattern() const override
+  { return true; }
+
+  /**
+   * Allocates every entry of \p sparsity_pattern (with zero values)
+   * and compresses the matrix.  Subsequent calls to \p add_matrix()
+   * add directly into this structure, rather than searching for (and
+   * possibly inserting) each entry individually, and \p zero()
+   * preserves it.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph & sparsity_pattern) override;
 
   virtual void init (const numeric_index_type m,
                      const numeric_index_type n,
@@ -101,7 +125,7 @@ public:
 
   virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
 
-  virtual void close () override { this->_closed = true; }
+  virtual void close () override;
 
   virtual numeric_index_type m () const override;
 
@@ -119,6 +143,14 @@ public:
                     const numeric_index_type j,
                     const T value) override;
 
+  /**
+   * Adds \p dm into the rows \p rows and columns \p cols.
+   *
+   * Once the structure has been fixed by \p update_sparsity_pattern()
+   * every entry of \p dm must lie within it (zero entries excepted),
+   * and rows are updated under a lock on their row block, so that
+   * several threads may add element matrices concurrently.
+   */
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & rows,
                            const std::vector<numeric_index_type> & cols) override;
@@ -126,6 +158,11 @@ public:
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & dof_indices) override;
 
+  /**
+   * Adds \p a times \p X, which may be an \p EigenSparseMatrix of
+   * either full or reduced precision, rounding the result to our
+   * precision.
+   */
   virtual void add (const T a, const SparseMatrix<T> & X) override;
 
   virtual T operator () (const numeric_index_type i,
@@ -137,6 +174,9 @@ public:
 
   virtual bool closed() const override { return _closed; }
 
+  virtual bool supports_concurrent_add_matrix() const override
+  { return _fixed_pattern && _mat.isCompressed(); }
+
   virtual void print_personal(std::ostream & os=libMesh::out) const override { this->print(os); }
 
   virtual void get_diagonal (NumericVector<T> & dest) const override;
@@ -155,13 +195,62 @@ private:
    */
   bool _closed;
 
+  /**
+   * Flag indicating that the nonzero structure of \p _mat was set by
+   * \p update_sparsity_pattern() and should be kept compressed.
+   */
+  bool _fixed_pattern;
+
+  /**
+   * Identifies the current fixed nonzero structure: it is unique to
+   * each structure built by \p update_sparsity_pattern() and is
+   * renewed whenever that structure grows, so solvers can tell when
+   * a symbolic factorization may be reused.  Copies share the id of
+   * the original.  It is zero when there is no fixed structure.
+   */
+  std::size_t _pattern_id;
+
+  /**
+   * Nonzero entries which \p add_matrix() found outside the fixed
+   * structure, as (row, column, value).  Inserting them would move
+   * the entries other threads are adding to, so they wait here until
+   * \p close() or \p zero() inserts them and compresses the grown
+   * structure.
+   */
+  std::vector<std::tuple<numeric_index_type, numeric_index_type, S>> _pending_entries;
+
+  /**
+   * Inserts the \p _pending_entries.
+   */
+  void insert_pending_entries ();
+
   /**
    * Make other Eigen datatypes friends
    */
   friend class EigenSparseVector<T>;
   friend class EigenSparseLinearSolver<T>;
+  template <typename, typename> friend class EigenSparseMatrix;
+  friend class GeometricMultigridPreconditioner<T>;
 };
 
+
+
+/**
+ * A serial sparse matrix which stores its values in single
+ * precision, with the sparsity pattern of the system matrix.  It is
+ * meant to be used as a preconditioning matrix, e.g. from
+ * \p ImplicitSystem::reduced_precision_preconditioner, where it
+ * halves the memory and memory bandwidth needed to set up and apply
+ * the preconditioner while the Krylov iterations still use the full
+ * precision operator.
+ *
+ * Values are rounded to single precision as they are added, so
+ * accumulating many contributions in place loses more accuracy than
+ * copying a fully assembled matrix with \p add().
+ */
+template <typename T>
+using EigenReducedPrecisionMatrix = EigenSparseMatrix<T, EigenReducedScalar>;
+
 } // namespace libMesh
 
 #endif // #ifdef LIBMESH_HAVE_EIGEN
@@ -38,7 +38,6 @@ namespace libMesh
 {
 
 // Forward declarations
-template <typename T> class EigenSparseMatrix;
 template <typename T> class EigenSparseLinearSolver;
 template <typename T> class SparseMatrix;
 
@@ -249,7 +248,7 @@ private:
   /**
    * Make other Eigen datatypes friends
    */
-  friend class EigenSparseMatrix<T>;
+  template <typename, typename> friend class EigenSparseMatrix;
   friend class EigenSparseLinearSolver<T>;
 };
 
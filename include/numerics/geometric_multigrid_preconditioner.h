@@ -0,0 +1,222 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_GEOMETRIC_MULTIGRID_PRECONDITIONER_H
+#define LIBMESH_GEOMETRIC_MULTIGRID_PRECONDITIONER_H
+
+#include "libmesh/libmesh_config.h"
+
+#if defined(LIBMESH_HAVE_EIGEN) && defined(LIBMESH_ENABLE_AMR)
+
+// Local includes
+#include "libmesh/preconditioner.h"
+#include "libmesh/eigen_core_support.h"
+
+// Eigen includes
+#include "libmesh/ignore_warnings.h"
+#include <Eigen/SparseLU>
+#include "libmesh/restore_warnings.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class System;
+
+/**
+ * This class implements a geometric multigrid V-cycle for the serial
+ * Eigen (or Laspack) builds of libMesh, which otherwise offer only
+ * pointwise and incomplete factorization preconditioners.
+ *
+ * The levels are those of the \p MeshRefinement hierarchy of the
+ * system's mesh: level \p l consists of the level \p l ancestors of
+ * the active elements, or of the active elements themselves where
+ * those are coarser.  Prolongation from level \p l to level \p l+1
+ * interpolates the parent's shape functions at the nodes of its
+ * children, as \p System::projection_matrix() would, and is built
+ * directly from the refinement tree, so the mesh is never coarsened
+ * and the \p DofMap of the system is left untouched.  The coarse
+ * operators are the Galerkin products \f$ P^T A P \f$, the smoother
+ * is either Chebyshev or damped Jacobi, threaded over the rows of
+ * each level, and the coarsest level is solved directly with a
+ * sparse LU factorization.
+ *
+ * All variables of the system must be of the \p LAGRANGE family,
+ * which makes the coarse degrees of freedom a subset of the fine
+ * ones.  The mesh should have been refined uniformly; locally
+ * refined meshes are handled, but their coarse levels contain
+ * hanging nodes which are treated as independent.
+ *
+ * Attach this preconditioner to an \p EigenSparseLinearSolver with
+ * \p LinearSolver::attach_preconditioner().  The transfer operators
+ * are rebuilt by \p init() only when the mesh or its degrees of
+ * freedom have changed; the coarse operators are rebuilt by \p
+ * setup() whenever the matrix may have changed.
+ *
+ * \date 2021
+ * \brief Native geometric multigrid preconditioner.
+ */
+template <typename T>
+class GeometricMultigridPreconditioner : public Preconditioner<T>
+{
+public:
+  /**
+   * Constructor.  The levels are built from the mesh and the
+   * degrees of freedom of \p system.
+   */
+  GeometricMultigridPreconditioner (const System & system);
+
+  virtual ~GeometricMultigridPreconditioner () = default;
+
+  virtual void apply(const NumericVector<T> & x, NumericVector<T> & y) override;
+
+  virtual void clear () override;
+
+  virtual void init () override;
+
+  virtual void setup () override;
+
+  /**
+   * The maximum number of levels to use, including the finest.  The
+   * default, 0, uses every level of the refinement hierarchy.
+   */
+  unsigned int & max_levels () { return _max_levels; }
+
+  /**
+   * The number of pre- and post-smoothing steps on each level.
+   * Defaults to 2.
+   */
+  unsigned int & n_smoothing_steps () { return _n_smoothing_steps; }
+
+  /**
+   * If \p true (the default), smooth with Chebyshev polynomials of
+   * the Jacobi preconditioned operator, targeting the upper part of
+   * its spectrum.  Otherwise use damped Jacobi iterations.
+   */
+  bool & chebyshev_smoothing () { return _chebyshev_smoothing; }
+
+  /**
+   * The damping factor of the Jacobi smoother.  Defaults to 2/3.
+   */
+  Real & jacobi_weight () { return _jacobi_weight; }
+
+  /**
+   * \returns The number of levels built by \p init().
+   */
+  unsigned int n_levels () const
+  { return cast_int<unsigned int>(_prolongations.size() + 1); }
+
+private:
+
+  /**
+   * \returns The operator of level \p l; the finest level uses the
+   * preconditioning matrix itself.
+   */
+  const EigenSM & level_operator (unsigned int l) const;
+
+  /**
+   * Builds the prolongation (and restriction) operators between
+   * every pair of consecutive levels.
+   */
+  void build_transfer_operators ();
+
+  /**
+   * \returns A hash of the mesh and degrees of freedom the transfer
+   * operators are built from.
+   */
+  std::size_t hierarchy_signature () const;
+
+  /**
+   * Estimates the largest eigenvalue of the Jacobi preconditioned
+   * operator of level \p l by power iteration.
+   */
+  Real estimate_max_eigenvalue (unsigned int l);
+
+  /**
+   * Applies \p n_smoothing_steps() smoothing steps to \p x on level
+   * \p l, for the right hand side \p b.
+   */
+  void smooth (unsigned int l, const EigenSV & b, EigenSV & x);
+
+  /**
+   * Applies a V-cycle, from a zero initial guess, to the right hand
+   * side \p b on level \p l, returning the result in \p x.
+   */
+  void v_cycle (unsigned int l, const EigenSV & b, EigenSV & x);
+
+  /**
+   * The system whose mesh and degrees of freedom define the levels.
+   */
+  const System & _system;
+
+  unsigned int _max_levels;
+  unsigned int _n_smoothing_steps;
+  bool _chebyshev_smoothing;
+  Real _jacobi_weight;
+
+  /**
+   * \p _prolongations[l] maps level \p l to level \p l+1, and \p
+   * _restrictions[l] is its transpose, stored explicitly so that
+   * both can be applied row by row.
+   */
+  std::vector<EigenSM> _prolongations;
+  std::vector<EigenSM> _restrictions;
+
+  /**
+   * The Galerkin operators of all levels but the finest.
+   */
+  std::vector<EigenSM> _coarse_operators;
+
+  /**
+   * The finest level operator, i.e. the preconditioning matrix.
+   */
+  const EigenSM * _fine_operator;
+
+  /**
+   * The inverse diagonal and the largest eigenvalue estimate of the
+   * Jacobi preconditioned operator of each level.
+   */
+  std::vector<EigenSV> _inv_diagonals;
+  std::vector<Real> _max_eigenvalues;
+
+  /**
+   * Factorization of the coarsest level operator.
+   */
+  Eigen::SparseLU<EigenSM> _coarse_solver;
+
+  /**
+   * Work vectors for each level: right hand sides, solutions,
+   * residuals and smoother updates.
+   */
+  std::vector<EigenSV> _b, _x, _r, _d;
+
+  /**
+   * The value of \p hierarchy_signature() when the transfer
+   * operators were last built.
+   */
+  std::size_t _signature;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_EIGEN && LIBMESH_ENABLE_AMR
+#endif // LIBMESH_GEOMETRIC_MULTIGRID_PRECONDITIONER_H
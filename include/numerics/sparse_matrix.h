@@ -102,6 +102,15 @@ public:
         const SolverPackage solver_package = libMesh::default_solver_package(),
         const MatrixBuildType matrix_build_type = MatrixBuildType::AUTOMATIC);
 
+  /**
+   * \returns \p true if \p build() with \p solver_package can build
+   * a matrix for \p MatrixBuildType::REDUCED_PRECISION, i.e. one
+   * storing its values in reduced precision.  Currently only Eigen
+   * can; other packages throw an error when asked to.
+   */
+  static bool
+  supports_reduced_precision(const SolverPackage solver_package = libMesh::default_solver_package());
+
   /**
    * \returns \p true if the matrix has been initialized,
    * \p false otherwise.
@@ -145,6 +154,14 @@ public:
    */
   virtual void update_sparsity_pattern (const SparsityPattern::Graph &) {}
 
+  /**
+   * \returns \p true if \p add_matrix() may currently be called on
+   * this matrix from several threads at once, without any external
+   * locking.  This is false by default.
+   */
+  virtual bool supports_concurrent_add_matrix() const
+  { return false; }
+
   /**
    * Initialize SparseMatrix with the specified sizes.
    *
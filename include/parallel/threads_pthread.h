@@ -213,7 +213,9 @@ private:
 template <typename Range>
 unsigned int num_pthreads(Range & range)
 {
-  std::size_t min = std::min((std::size_t)libMesh::n_threads(), range.size());
+  // StoredRange::size() is a std::size_t, BlockedRange::size() an int
+  std::size_t min = std::min((std::size_t)libMesh::n_threads(),
+                             static_cast<std::size_t>(range.size()));
   return min > 0 ? cast_int<unsigned int>(min) : 1;
 }
 
@@ -22,15 +22,12 @@
 
 #include "libmesh/libmesh_config.h"
 
-#if defined(LIBMESH_HAVE_TRIANGLE) && defined(LIBMESH_HAVE_TETGEN)
-
 // Local includes
 #include "libmesh/quadrature.h"
-#include "libmesh/elem_cutter.h"
-#include "libmesh/fe_base.h"
+#include "libmesh/simplex_cutter.h"
 
 // C++ includes
-#include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -40,8 +37,14 @@ namespace libMesh
  * Composite quadrature rules are constructed from any of the
  * supported rules by breaking an element into subelements and
  * applying the base rule on each subelement.  This class uses the
- * ElemCutter, which is only available if libmesh is configured with
- * --disable-strict-lgpl.
+ * SimplexCutter, which splits the element into simplices and cuts
+ * those along the linear interpolant of the distance function, and
+ * maps the base rule onto each resulting simplex directly.
+ *
+ * Cutting the same element type with the same vertex distances (and
+ * p level) twice in a row, e.g. for several FE objects on the same
+ * element, reuses the previous rule.  Each thread should use its own
+ * QComposite object.
  *
  * \author Benjamin Kirk
  * \date 2013
@@ -66,18 +69,13 @@ public:
   QComposite (unsigned int dim,
               Order order=INVALID_ORDER);
 
-  /**
-   * This class contains a unique_ptr member, so it can't be default
-   * copy constructed or assigned.
-   */
-  QComposite (const QComposite &) = delete;
-  QComposite & operator= (const QComposite &) = delete;
-
   /**
    * Copy/move ctor, copy/move assignment operator, and destructor are
    * all explicitly defaulted for this simple class.
    */
+  QComposite (const QComposite &) = default;
   QComposite (QComposite &&) = default;
+  QComposite & operator= (const QComposite &) = default;
   QComposite & operator= (QComposite &&) = default;
   virtual ~QComposite() = default;
 
@@ -87,20 +85,23 @@ public:
   virtual QuadratureType type() const override;
 
   /**
-   * Overrides the base class init() function, and uses the ElemCutter to
-   * subdivide the element into "inside" and "outside" subelements.
+   * Overrides the base class init() function, and uses the
+   * SimplexCutter to subdivide the element into "inside" and
+   * "outside" subelements.  The points of the inside subelements
+   * come first, see \p n_inside_points().
    */
   virtual void init (const Elem & elem,
                      const std::vector<Real> & vertex_distance_func,
                      unsigned int p_level=0) override;
 
-private:
-
   /**
-   * Helper function called from init() to collect all the points and
-   * weights of the subelement quadrature rules.
+   * \returns The number of points, at the front of the rule, which
+   * lie inside the cutting surface after the last init() of a cut
+   * element.
    */
-  void add_subelem_values (const std::vector<Elem const *> & subelem);
+  unsigned int n_inside_points () const { return _n_inside_points; }
+
+private:
 
   /**
    * Subcell quadrature object.
@@ -108,17 +109,28 @@ private:
   QSubCell _q_subcell;
 
   /**
-   * ElemCutter object.
+   * Quadrature object for the simplices of cut elements.
+   */
+  QSubCell _q_simplex;
+
+  /**
+   * SimplexCutter object.
    */
-  ElemCutter _elem_cutter;
+  SimplexCutter _simplex_cutter;
+
+  unsigned int _n_inside_points;
 
   /**
-   * Lagrange FE to use for subcell mapping.
+   * The element type, p level and vertex distances of the last cut
+   * element, for which the current points and weights are valid as
+   * long as \p _cache_valid is set.
    */
-  std::unique_ptr<FEBase> _lagrange_fe;
+  bool _cache_valid;
+  ElemType _cached_elem_type;
+  unsigned int _cached_p_level;
+  std::vector<Real> _cached_distances;
 };
 
 } // namespace libMesh
 
-#endif // LIBMESH_HAVE_TRIANGLE && LIBMESH_HAVE_TETGEN
 #endif // LIBMESH_QUADRATURE_COMPOSITE_H
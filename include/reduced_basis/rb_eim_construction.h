@@ -80,6 +80,16 @@ public:
    */
   typedef RBEIMEvaluation::QpDataMap QpDataMap;
 
+  /**
+   * The scalar type used to store the training set in single
+   * precision, see \p set_single_precision_training_data().
+   */
+#ifdef LIBMESH_USE_COMPLEX_NUMBERS
+  typedef std::complex<float> SinglePrecisionNumber;
+#else
+  typedef float SinglePrecisionNumber;
+#endif
+
   /**
    * Clear this object.
    */
@@ -101,6 +111,15 @@ public:
    */
   void initialize_eim_construction();
 
+  /**
+   * Store the parametrized functions of the training set in single
+   * rather than full precision, which halves the largest data
+   * structure of the EIM training.  Best fit errors are still
+   * computed in full precision.  This must be set before \p
+   * initialize_eim_construction().
+   */
+  void set_single_precision_training_data(bool single_precision);
+
   /**
    * Read parameters in from file and set up this system
    * accordingly.
@@ -216,16 +235,15 @@ private:
    * Find the training sample that has the largest EIM approximation error
    * based on the current EIM approximation. Return the maximum error, and
    * the training sample index at which it occured.
+   *
+   * The best fits of all training samples are computed together: the
+   * inner products with the basis functions, for projection best
+   * fits, and the maximum (i.e. l-infinity norm) errors are each a
+   * single threaded, cache-blocked product of the training data with
+   * the basis, followed by a single reduction across processors.
    */
   std::pair<Real, unsigned int> compute_max_eim_error();
 
-  /**
-   * Compute the maximum (i.e. l-infinity norm) error of the best fit
-   * of the parametrized function at training index \p training_index
-   * into the EIM approximation space.
-   */
-  Real compute_best_fit_error(unsigned int training_index);
-
   /**
    * Compute and store the parametrized function for each
    * parameter in the training set at all the stored qp locations.
@@ -239,18 +257,42 @@ private:
   void initialize_qp_data();
 
   /**
-   * Evaluate the inner product of vec1 and vec2 which specify values at
-   * quadrature points. The inner product includes the JxW contributions
-   * stored in _local_quad_point_JxW, so that this is equivalent to
-   * computing w^t M v, where M is the mass matrix.
+   * Set up the row ordering of the flattened quadrature point data
+   * from the data stored by initialize_qp_data().
+   */
+  void initialize_local_rows();
+
+  /**
+   * \returns The row of (elem_id, comp, qp) in the flattened
+   * quadrature point data, or the largest std::size_t if elem_id is
+   * not local.
+   */
+  std::size_t local_row(dof_id_type elem_id,
+                        unsigned int comp,
+                        unsigned int qp) const;
+
+  /**
+   * \returns The value of the parametrized function of training
+   * sample \p training_index at (elem_id, comp, qp), on every processor.
    */
-  Number inner_product(const QpDataMap & v, const QpDataMap & w);
+  Number get_training_function_value(unsigned int training_index,
+                                     dof_id_type elem_id,
+                                     unsigned int comp,
+                                     unsigned int qp) const;
 
   /**
-   * Get the maximum absolute value from a vector stored in the format that we use
-   * for basis functions.
+   * \returns The parametrized function of training sample \p
+   * training_index in the format that we use for basis functions.
    */
-  Real get_max_abs_value(const QpDataMap & v) const;
+  QpDataMap get_training_function(unsigned int training_index) const;
+
+  /**
+   * Evaluate the inner product of vec1 and vec2 which specify values at
+   * quadrature points, in the flattened row ordering. The inner product
+   * includes the JxW contributions, so that this is equivalent to
+   * computing w^t M v, where M is the mass matrix.
+   */
+  Number inner_product(const Number * v, const Number * w);
 
   /**
    * Add a new basis function to the EIM approximation.
@@ -262,15 +304,6 @@ private:
    */
   void update_eim_matrices();
 
-  /**
-   * We compute the best fit of parametrized_function
-   * into the EIM space and then evaluate the error
-   * in the norm defined by inner_product_matrix.
-   *
-   * \returns The error in the best fit
-   */
-  Real compute_best_fit_error();
-
   /**
    * Scale all values in \p pf by \p scaling_factor
    */
@@ -306,18 +339,38 @@ private:
    */
   std::vector<std::unique_ptr<ElemAssembly>> _rb_eim_assembly_objects;
 
+  /**
+   * The quadrature point data on elements local to this processor is
+   * flattened into rows, in a fixed ordering: by element ID, then
+   * component, then quadrature point.  These are the local element
+   * IDs in ascending order, the first row of each (with the total
+   * number of rows at the end), the number of components, and the
+   * JxW value of each row.
+   */
+  std::vector<dof_id_type> _local_elem_ids;
+  std::vector<std::size_t> _local_elem_first_row;
+  unsigned int _n_comps;
+  std::vector<Real> _local_row_JxW;
+
   /**
    * The parametrized functions that are used for training. We pre-compute and
    * store all of these functions, rather than recompute them at each iteration
    * of the training.
    *
-   * We store values at quadrature points on elements that are local to this processor.
-   * The indexing is as follows:
-   *   basis function index --> element ID --> variable --> quadrature point --> value
-   * We use a map to index the element ID, since the IDs on this processor in
-   * generally will not start at zero.
+   * We store values at quadrature points on elements that are local to this processor,
+   * in a column-major matrix with one row per quadrature point (see above) and one
+   * column per training sample.  Only one of these vectors is used, depending on
+   * _single_precision_training_data.
+   */
+  std::vector<Number> _local_parametrized_functions_for_training;
+  std::vector<SinglePrecisionNumber> _local_parametrized_functions_for_training_single;
+  bool _single_precision_training_data;
+
+  /**
+   * The EIM basis functions in the same column-major layout, with one
+   * column per basis function.
    */
-  std::vector<QpDataMap> _local_parametrized_functions_for_training;
+  std::vector<Number> _local_basis_functions;
 
   /**
    * Maximum value in _local_parametrized_functions_for_training across all processors.
@@ -32,6 +32,10 @@
 #include "libmesh/eigen_sparse_matrix.h"
 #include "libmesh/enum_convergence_flags.h" // The build_map() function uses these.
 
+// C++ includes
+#include <memory>
+#include <typeinfo>
+
 
 namespace libMesh
 {
@@ -69,7 +73,25 @@ public:
   virtual void init (const char * name=nullptr) override;
 
   /**
-   * Call the Eigen solver
+   * Call the Eigen solver.
+   *
+   * The iterative solvers are preconditioned according to
+   * \p _preconditioner_type: \p IDENTITY_PRECOND, \p JACOBI_PRECOND,
+   * \p ILU_PRECOND (Eigen's \p IncompleteLUT) and \p ICC_PRECOND
+   * (Eigen's \p IncompleteCholesky) are supported, as is a
+   * \p Preconditioner object, e.g. a
+   * \p GeometricMultigridPreconditioner, attached with
+   * \p attach_preconditioner().  Unlike other solver packages we
+   * default to \p JACOBI_PRECOND, and \p CG, which needs a
+   * symmetric preconditioner, falls back to it from
+   * \p ILU_PRECOND.  The symbolic
+   * analysis of the preconditioner, or of the \p SPARSELU
+   * factorization, is reused by subsequent solves with the same
+   * solver settings as long as the matrix keeps the sparsity pattern
+   * it was given by the \p DofMap.
+   *
+   * Eigen's OpenMP-parallel kernels use \p libMesh::n_threads()
+   * threads.
    */
   virtual std::pair<unsigned int, Real>
   solve (SparseMatrix<T> & matrix,
@@ -89,7 +111,10 @@ public:
                  const unsigned int m_its) override;
 
   /**
-   * Call the Eigen solver
+   * Call the Eigen solver, building the preconditioner from \p pc
+   * rather than from \p matrix.  \p pc may be an \p EigenSparseMatrix
+   * or an \p EigenReducedPrecisionMatrix; in the latter case the
+   * preconditioner is built and applied in single precision.
    */
   virtual std::pair<unsigned int, Real>
   solve (SparseMatrix<T> & matrix,
@@ -135,11 +160,113 @@ private:
    */
   void set_eigen_preconditioner_type ();
 
+  /**
+   * Solves with \p matrix, building the preconditioner of an
+   * iterative solver from \p precond_matrix if it is given.
+   */
+  std::pair<unsigned int, Real>
+  solve_common (SparseMatrix<T> & matrix_in,
+                const SparseMatrix<T> * precond_matrix,
+                NumericVector<T> & solution_in,
+                NumericVector<T> & rhs_in,
+                const double tol,
+                const unsigned int m_its);
+
+  /**
+   * Solves with the iterative solver selected by \p _solver_type,
+   * with the preconditioner selected by \p _preconditioner_type built
+   * from the Eigen matrix \p pc_mat, which is either \p matrix
+   * itself or the storage of a separate preconditioning matrix.
+   * \p pc_pattern_id identifies the sparsity pattern of the latter.
+   */
+  template <typename PcMatrix>
+  std::pair<unsigned int, Real>
+  solve_iterative (EigenSparseMatrix<T> & matrix,
+                   const PcMatrix & pc_mat,
+                   const std::size_t pc_pattern_id,
+                   EigenSparseVector<T> & solution,
+                   EigenSparseVector<T> & rhs,
+                   const double tol,
+                   const unsigned int m_its);
+
+  /**
+   * Readies the attached \p _preconditioner object for a solve with
+   * \p matrix, or with \p precond_in if that is given: it is only
+   * initialized again when that matrix or its sparsity pattern
+   * changes, and only set up again when its values might have, i.e.
+   * unless \p same_preconditioner is set.
+   */
+  void setup_shell_preconditioner (EigenSparseMatrix<T> & matrix,
+                                   const SparseMatrix<T> * precond_in);
+
+  /**
+   * Solves with the iterative solver selected by \p _solver_type,
+   * preconditioned by the attached \p _preconditioner object.
+   */
+  std::pair<unsigned int, Real>
+  solve_shell_preconditioned (EigenSparseMatrix<T> & matrix,
+                              EigenSparseVector<T> & solution,
+                              EigenSparseVector<T> & rhs,
+                              const double tol,
+                              const unsigned int m_its);
+
+  /**
+   * Solves with the Eigen iterative solver \p Solver, whose
+   * preconditioner is built from \p pc_mat: an Eigen matrix, or a
+   * \p Preconditioner object.
+   */
+  template <typename Solver, typename PcMatrix>
+  std::pair<unsigned int, Real>
+  solve_with (EigenSparseMatrix<T> & matrix,
+              PcMatrix & pc_mat,
+              const std::size_t pc_pattern_id,
+              EigenSparseVector<T> & solution,
+              EigenSparseVector<T> & rhs,
+              const double tol,
+              const unsigned int m_its);
+
+  /**
+   * \returns The cached Eigen solver object of type \p Solver if its
+   * symbolic analysis applies to \p matrix (and to the separate
+   * preconditioning matrix identified by \p pc_pattern_id), or else a
+   * new one which has analyzed \p matrix and replaces the cache.
+   */
+  template <typename Solver>
+  std::shared_ptr<Solver> analyzed_solver (const EigenSparseMatrix<T> & matrix,
+                                           const std::size_t pc_pattern_id);
+
   /**
    * Store the result of the last solve.
    */
   Eigen::ComputationInfo _comp_info;
 
+  /**
+   * The Eigen solver object used by the last solve, kept for its
+   * symbolic analysis, and its type.
+   */
+  std::shared_ptr<void> _cached_solver;
+
+  const std::type_info * _cached_solver_class;
+
+  /**
+   * The sparsity patterns analyzed by \p _cached_solver, identified
+   * by their \p _pattern_id.  Zero means there is nothing to reuse.
+   */
+  std::size_t _cached_pattern_id;
+
+  std::size_t _cached_pc_pattern_id;
+
+  /**
+   * The preconditioner object last initialized by
+   * \p setup_shell_preconditioner(), the matrix it was initialized
+   * with, and that matrix's \p _pattern_id at the time.
+   */
+  const Preconditioner<T> * _shell_pc;
+
+  const SparseMatrix<T> * _shell_pc_matrix;
+
+  std::size_t _shell_pc_pattern_id;
+
   /**
    * Static map between Eigen ComputationInfo enumerations and libMesh
    * LinearConvergenceReason enumerations.
@@ -178,24 +305,6 @@ EigenSparseLinearSolver<T>::~EigenSparseLinearSolver ()
   this->clear ();
 }
 
-
-
-template <typename T>
-inline
-std::pair<unsigned int, Real>
-EigenSparseLinearSolver<T>::solve (SparseMatrix<T> &,
-                                   SparseMatrix<T> &,
-                                   NumericVector<T> &,
-                                   NumericVector<T> &,
-                                   const double,
-                                   const unsigned int)
-{
-  libmesh_error_msg("ERROR: Eigen does not support a user-supplied preconditioner!");
-
-  std::pair<unsigned int, Real> p;
-  return p;
-}
-
 } // namespace libMesh
 
 #endif // #ifdef LIBMESH_HAVE_EIGEN
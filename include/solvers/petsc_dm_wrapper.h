@@ -105,6 +105,15 @@ namespace libMesh
     //! Destroys and clears all build DM-related data
     void clear();
 
+    /**
+     * Builds the DM hierarchy for \p system, walking down the mesh
+     * refinement tree, and attaches the finest DM to \p snes.
+     *
+     * The hierarchy is cached: if the mesh hasn't been modified and
+     * the dof numbering of \p system hasn't changed since the last
+     * call, the existing DMs, sections and interpolation matrices
+     * are simply attached to \p snes.
+     */
     void init_and_attach_petscdm(System & system, SNES & snes);
 
   private:
@@ -169,6 +178,37 @@ namespace libMesh
     //! Stores n_local_dofs for each grid level, to be used for projection vector sizing
     std::vector<unsigned int> _mesh_dof_loc_sizes;
 
+    /**
+     * Hash of the mesh and dof numbering the cached hierarchy was
+     * built for, or 0 if there is no hierarchy.
+     */
+    std::size_t _signature = 0;
+
+    /**
+     * The data hashed into \p _signature, compared exactly when the
+     * hashes match.
+     */
+    std::vector<dof_id_type> _signature_data;
+
+    /**
+     * The \p MeshBase::modification_count() of the mesh the cached
+     * hierarchy was built for.  Any later modification invalidates
+     * the hierarchy.
+     */
+    std::size_t _mesh_modification_count = 0;
+
+    /**
+     * Fills \p data with the ids, levels and dof indices of the
+     * active local elements of the mesh of \p system, and with
+     * \p n_levels, for deciding whether a cached hierarchy is still
+     * valid.
+     *
+     * \returns A hash of \p data.
+     */
+    std::size_t hierarchy_signature(const System & system,
+                                    unsigned int n_levels,
+                                    std::vector<dof_id_type> & data) const;
+
     //! Init all the n_mesh_level dependent data structures
     void init_dm_data(unsigned int n_levels, const Parallel::Communicator & comm);
 
@@ -31,6 +31,7 @@ namespace libMesh
 {
 
 // Forward declarations
+class StaticCondensation;
 template <typename T> class LinearSolver;
 
 /**
@@ -103,6 +104,12 @@ public:
    */
   virtual void assemble () override;
 
+  /**
+   * Reinitializes the system matrices, and the attached static
+   * condensation if there is one, on the current mesh.
+   */
+  virtual void reinit () override;
+
   /**
    * Avoids use of any cached data that might affect any solve result.  Should
    * be overridden in derived systems.
@@ -325,6 +332,47 @@ public:
    */
   bool zero_out_matrix_and_rhs;
 
+  /**
+   * If this flag is true, the system adds a "Preconditioner" matrix
+   * which shares the sparsity pattern of the system matrix but stores
+   * its values in single precision.  It is refilled from the system
+   * matrix after every assembly of the latter, and the linear solver
+   * builds its preconditioner from it while the Krylov iterations
+   * still use the full precision system matrix.  This flag must be
+   * set before the system is initialized, and any user-assembled
+   * "Preconditioner" matrix will then be overwritten.
+   *
+   * Only Eigen can store a matrix in single precision (see
+   * \p SparseMatrix::supports_reduced_precision()); initializing the
+   * system with the flag set and another solver package is an error.
+   */
+  bool reduced_precision_preconditioner;
+
+  /**
+   * \returns \p true if the system keeps a reduced precision
+   * "Preconditioner" matrix, i.e. if \p reduced_precision_preconditioner
+   * is set and supported by the solver package.
+   */
+  bool has_reduced_precision_preconditioner () const;
+
+  /**
+   * Attaches the \p StaticCondensation which will solve this system,
+   * or detaches it if \p condensation is null.  This is done by the
+   * \p StaticCondensation constructor and destructor, before the
+   * system is initialized.  A system with a static condensation does
+   * not allocate a system matrix (or its sparsity pattern), so its
+   * own \p assemble() and \p solve() throw an error, and it
+   * reinitializes the condensation whenever its degrees of freedom
+   * are redistributed.
+   */
+  void attach_static_condensation (StaticCondensation * condensation);
+
+  /**
+   * \returns The attached \p StaticCondensation, or \p nullptr.
+   */
+  StaticCondensation * get_static_condensation () const
+  { return _static_condensation; }
+
   /**
    * This class handles all the details of interfacing with various
    * linear algebra packages like PETSc or LASPACK.  This is a public
@@ -337,9 +385,28 @@ public:
 
 protected:
   /**
-   * Adds the system matrix
+   * Adds the system matrix, and the reduced precision preconditioning
+   * matrix if requested.
    */
   virtual void add_matrices() override;
+
+  /**
+   * Initializes the matrices, and the attached static condensation
+   * if there is one.
+   */
+  virtual void init_matrices() override;
+
+  /**
+   * Copies the (assembled) system matrix into the reduced precision
+   * "Preconditioner" matrix, if there is one.
+   */
+  void update_reduced_precision_preconditioner();
+
+private:
+  /**
+   * The static condensation solving this system, if any.
+   */
+  StaticCondensation * _static_condensation;
 };
 
 
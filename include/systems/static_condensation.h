@@ -0,0 +1,289 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_STATIC_CONDENSATION_H
+#define LIBMESH_STATIC_CONDENSATION_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+// C++ includes
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class ImplicitSystem;
+template <typename T> class LinearSolver;
+template <typename T> class NumericVector;
+template <typename T> class SparseMatrix;
+
+/**
+ * This class solves a linear \p ImplicitSystem by static condensation
+ * of the element-interior degrees of freedom of selected variables.
+ *
+ * A degree of freedom is element-interior if it is stored on the
+ * element itself, or on a node which lies on none of the element's
+ * sides, such as the center node of a \p QUAD9.  For high order
+ * \p HIERARCHIC, \p L2_HIERARCHIC or \p SZABAB variables these are
+ * most of the degrees of freedom, and since they couple only within
+ * their own element they can be eliminated element by element.
+ *
+ * The user's assembly passes each (constrained) element matrix and
+ * right hand side to \p add_element_system() instead of adding them
+ * to the system matrix.  Several contributions on one element, such
+ * as its interior and boundary side terms, are summed.  \p solve()
+ * then factors the interior block of every element matrix, in a
+ * threaded batch over the elements, assembles the Schur complements
+ * into a matrix over the remaining "skeleton" (vertex, edge and face)
+ * degrees of freedom only, solves that, and recovers the interior
+ * values element by element.  The result is written to the system's
+ * solution vector.
+ *
+ * The condensation attaches itself to the system, which then
+ * allocates no system matrix, and is reinitialized by the system
+ * whenever its degrees of freedom are redistributed.  The skeleton
+ * degrees of freedom are numbered contiguously on each processor, in
+ * the order of the system's own numbering.  Interior degrees of
+ * freedom must not be constrained.
+ *
+ * \date 2021
+ * \brief Static condensation of element-interior degrees of freedom.
+ */
+class StaticCondensation : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  This attaches the condensation to \p system, which
+   * must not have been initialized yet.  No variables are condensed
+   * until \p condense_variable() is called.
+   */
+  explicit
+  StaticCondensation (ImplicitSystem & system);
+
+  /**
+   * Destructor.  Detaches the condensation from the system.
+   */
+  ~StaticCondensation ();
+
+  /**
+   * Selects variable \p var, whose element-interior degrees of
+   * freedom will be condensed.  Variables selected after the system
+   * is initialized only take effect at the next \p init().
+   */
+  void condense_variable (unsigned int var);
+
+  /**
+   * \returns \p true if the interior degrees of freedom of variable
+   * \p var are condensed.
+   */
+  bool condensed_variable (unsigned int var) const
+  { return _condensed_vars.count(var); }
+
+  /**
+   * Numbers the skeleton degrees of freedom and discards the
+   * skeleton system.  The system calls this when it is initialized
+   * and reinitialized.
+   */
+  void init ();
+
+  /**
+   * Discards the element systems added since the last \p solve().
+   */
+  void zero ();
+
+  /**
+   * Adds the element matrix \p Ke and right hand side \p Fe, with
+   * degrees of freedom \p dof_indices, of an active local element.
+   * Constraints should already have been applied to them.  A
+   * contribution is summed into the system of the element whose
+   * condensed degrees of freedom it involves, so an element may be
+   * added more than once, but no contribution may involve the
+   * condensed degrees of freedom of two elements, as a DG flux term
+   * of a condensed variable would.  This may be called from several
+   * threads at once.
+   */
+  void add_element_system (const DenseMatrix<Number> & Ke,
+                           const DenseVector<Number> & Fe,
+                           const std::vector<dof_id_type> & dof_indices);
+
+  /**
+   * Condenses the element systems added since the last \p solve() or
+   * \p zero(), solves the skeleton system, and writes the solution,
+   * with the recovered interior values, to the solution of the
+   * system.
+   *
+   * \returns The number of iterations and the final residual of the
+   * skeleton solve.
+   */
+  std::pair<unsigned int, Real> solve ();
+
+  /**
+   * \returns The global number of skeleton degrees of freedom.
+   */
+  dof_id_type n_skeleton_dofs () const { return _n_skeleton_dofs; }
+
+  /**
+   * \returns The number of skeleton degrees of freedom on this
+   * processor.
+   */
+  dof_id_type n_local_skeleton_dofs () const
+  { return _last_skeleton_dof - _first_skeleton_dof; }
+
+  /**
+   * \returns The skeleton index of the local degree of freedom \p
+   * dof, or \p DofObject::invalid_id if \p dof is condensed.
+   */
+  dof_id_type local_skeleton_index (dof_id_type dof) const;
+
+private:
+
+  /**
+   * The condensation of one element system.
+   */
+  struct ElemSystem
+  {
+    // The degrees of freedom of the element system, and the same
+    // split into the skeleton ones and the condensed interior ones,
+    // with their positions in the element system
+    std::vector<dof_id_type> dofs;
+    std::vector<dof_id_type> skeleton_dofs, interior_dofs;
+    std::vector<unsigned int> skeleton_pos, interior_pos;
+
+    // The summed element matrix and right hand side, until condensed
+    DenseMatrix<Number> K;
+    DenseVector<Number> F;
+
+    // The Schur complement of the interior block and its right hand
+    // side, until added to the skeleton system
+    DenseMatrix<Number> schur;
+    DenseVector<Number> schur_rhs;
+
+    // K_II^{-1} K_IS and K_II^{-1} F_I, from which the interior
+    // values are recovered
+    DenseMatrix<Number> interior_map;
+    DenseVector<Number> interior_rhs;
+  };
+
+  class CondenseElemSystems;
+
+  /**
+   * Sums \p Ke and \p Fe into \p es, extending it by any degrees of
+   * freedom it does not have yet.
+   */
+  static void add_to_elem_system (ElemSystem & es,
+                                  const DenseMatrix<Number> & Ke,
+                                  const DenseVector<Number> & Fe,
+                                  const std::vector<dof_id_type> & dof_indices);
+
+  /**
+   * \returns The index in \p _elem_systems of the element of \p dof
+   * if it is a local condensed degree of freedom, or \p
+   * DofObject::invalid_id otherwise.
+   */
+  dof_id_type interior_elem (dof_id_type dof) const;
+
+  /**
+   * \returns The skeleton index of \p dof, which must be a skeleton
+   * degree of freedom that is either local or has been looked up by
+   * \p request_skeleton_indices().
+   */
+  dof_id_type skeleton_index (dof_id_type dof) const;
+
+  /**
+   * Looks up the skeleton indices of the non-local degrees of
+   * freedom of the element systems.
+   */
+  void request_skeleton_indices ();
+
+  /**
+   * Builds the skeleton matrix and vectors, with a sparsity pattern
+   * taken from the element systems.
+   */
+  void build_skeleton_system ();
+
+  ImplicitSystem & _system;
+
+  /**
+   * The variables whose interior degrees of freedom are condensed.
+   */
+  std::set<unsigned int> _condensed_vars;
+
+  /**
+   * The first degree of freedom of this processor, and the skeleton
+   * index of each local degree of freedom, or \p
+   * DofObject::invalid_id for condensed ones.
+   */
+  dof_id_type _first_local_dof;
+  std::vector<dof_id_type> _local_skeleton_indices;
+
+  /**
+   * The index in \p _elem_systems of the element of each local
+   * condensed degree of freedom, or \p DofObject::invalid_id for
+   * skeleton ones.
+   */
+  std::vector<dof_id_type> _local_interior_elems;
+
+  /**
+   * The number of active local elements, which have the first
+   * entries of \p _elem_systems.
+   */
+  std::size_t _n_local_elems;
+
+  /**
+   * The skeleton indices of the non-local skeleton degrees of
+   * freedom we have needed so far.
+   */
+  std::unordered_map<dof_id_type, dof_id_type> _nonlocal_skeleton_indices;
+
+  /**
+   * The global number of skeleton degrees of freedom and the range of
+   * those on this processor.
+   */
+  dof_id_type _n_skeleton_dofs;
+  dof_id_type _first_skeleton_dof, _last_skeleton_dof;
+
+  /**
+   * The element systems added since the last \p solve(): one for
+   * each active local element, followed by those contributions which
+   * involve no condensed degrees of freedom.
+   */
+  std::vector<ElemSystem> _elem_systems;
+
+  /**
+   * The skeleton system, with a sparsity pattern taken from the
+   * element systems of the first \p solve() after \p init().
+   */
+  std::unique_ptr<SparseMatrix<Number>> _matrix;
+  std::unique_ptr<NumericVector<Number>> _solution, _rhs;
+  std::unique_ptr<LinearSolver<Number>> _linear_solver;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_STATIC_CONDENSATION_H
@@ -762,6 +762,15 @@ public:
    */
   void set_basic_system_only ();
 
+  /**
+   * Sets whether \p reinit() should leave the matrices alone instead
+   * of resizing them for the current mesh.  While it is set, the
+   * matrices are unusable; the first \p reinit() after it is unset
+   * rebuilds them.  This lets the mesh be refined temporarily, e.g.
+   * by an error estimator, without allocating matrices for it.
+   */
+  void set_skip_matrix_reinit (bool skip);
+
   /**
    * Vector iterator typedefs.
    */
@@ -2161,6 +2170,11 @@ private:
    */
   bool _basic_system_only;
 
+  /**
+   * Holds true if \p reinit() should not touch the matrices.
+   */
+  bool _skip_matrix_reinit;
+
   /**
    * \p true when additional vectors and variables do not require
    * immediate initialization, \p false otherwise.
@@ -2303,6 +2317,14 @@ void System::set_basic_system_only ()
 
 
 
+inline
+void System::set_skip_matrix_reinit (bool skip)
+{
+  _skip_matrix_reinit = skip;
+}
+
+
+
 inline
 unsigned int System::n_vars() const
 {
@@ -0,0 +1,237 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ALIGNED_ARRAY_2D_H
+#define LIBMESH_ALIGNED_ARRAY_2D_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A two dimensional array stored in a single buffer, with the second
+ * ("column") index running fastest.  Every row begins on an \p
+ * alignment byte boundary whenever the size of \p T permits it, with
+ * rows padded as necessary, so that loops over a row can be
+ * vectorized with aligned loads.
+ *
+ * Rows are accessed as \p a[i][j], just like the
+ * \p std::vector<std::vector<T>> it is meant to replace in
+ * performance critical loops, e.g. the shape function values \p
+ * phi[i][qp] of a finite element.
+ *
+ * \date 2021
+ * \brief Contiguous, aligned, row-major 2D array.
+ */
+template <typename T>
+class AlignedArray2D
+{
+public:
+
+  /**
+   * Rows start on multiples of this many bytes.
+   */
+  static const std::size_t alignment = 64;
+
+  /**
+   * Lightweight view of a single row.
+   */
+  template <typename U>
+  class RowView
+  {
+  public:
+    RowView (U * data, std::size_t size) : _data(data), _size(size) {}
+
+    U & operator[] (std::size_t j) const
+    { libmesh_assert_less (j, _size); return _data[j]; }
+
+    std::size_t size () const { return _size; }
+    bool empty () const { return !_size; }
+
+    U * data () const { return _data; }
+    U * begin () const { return _data; }
+    U * end () const { return _data + _size; }
+
+  private:
+    U * _data;
+    std::size_t _size;
+  };
+
+  typedef RowView<T> Row;
+  typedef RowView<const T> ConstRow;
+
+  AlignedArray2D () : _n_rows(0), _n_cols(0), _stride(0), _offset(0) {}
+
+  AlignedArray2D (std::size_t n_rows, std::size_t n_cols) :
+    AlignedArray2D()
+  { this->resize(n_rows, n_cols); }
+
+  AlignedArray2D (const AlignedArray2D & other) :
+    AlignedArray2D()
+  { *this = other; }
+
+  AlignedArray2D (AlignedArray2D &&) = default;
+
+  AlignedArray2D & operator= (const AlignedArray2D & other)
+  {
+    if (this != &other)
+      {
+        this->resize(other._n_rows, other._n_cols);
+        for (std::size_t i = 0; i != _n_rows; ++i)
+          std::copy(other[i].begin(), other[i].end(), (*this)[i].begin());
+      }
+    return *this;
+  }
+
+  // Moving a std::vector keeps its buffer, and hence our alignment.
+  AlignedArray2D & operator= (AlignedArray2D &&) = default;
+
+  /**
+   * Resizes to \p n_rows rows of \p n_cols entries each.  Existing
+   * entries are not preserved.
+   */
+  void resize (std::size_t n_rows, std::size_t n_cols)
+  {
+    if (n_rows == _n_rows && n_cols == _n_cols)
+      return;
+
+    _n_rows = n_rows;
+    _n_cols = n_cols;
+
+    // Pad rows to the smallest multiple of the alignment which is a
+    // whole number of entries, if there is one of reasonable size.
+    const std::size_t step = row_step();
+    _stride = (n_cols + step - 1) / step * step;
+
+    // Leave room to shift the first row onto an aligned address.
+    _storage.clear();
+    _storage.resize(_n_rows * _stride + step);
+    _offset = aligned_offset(step);
+  }
+
+  /**
+   * Sets every entry to \p val.
+   */
+  void fill (const T & val)
+  { std::fill(_storage.begin(), _storage.end(), val); }
+
+  /**
+   * \returns The number of rows.
+   */
+  std::size_t size () const { return _n_rows; }
+
+  /**
+   * \returns The number of rows.
+   */
+  std::size_t n_rows () const { return _n_rows; }
+
+  /**
+   * \returns The number of entries in each row.
+   */
+  std::size_t n_cols () const { return _n_cols; }
+
+  /**
+   * \returns The distance, in entries, between the starts of
+   * consecutive rows.
+   */
+  std::size_t stride () const { return _stride; }
+
+  bool empty () const { return !_n_rows; }
+
+  Row operator[] (std::size_t i)
+  {
+    libmesh_assert_less (i, _n_rows);
+    return Row(this->data() + i * _stride, _n_cols);
+  }
+
+  ConstRow operator[] (std::size_t i) const
+  {
+    libmesh_assert_less (i, _n_rows);
+    return ConstRow(this->data() + i * _stride, _n_cols);
+  }
+
+  T & operator() (std::size_t i, std::size_t j)
+  {
+    libmesh_assert_less (i, _n_rows);
+    libmesh_assert_less (j, _n_cols);
+    return this->data()[i * _stride + j];
+  }
+
+  const T & operator() (std::size_t i, std::size_t j) const
+  {
+    libmesh_assert_less (i, _n_rows);
+    libmesh_assert_less (j, _n_cols);
+    return this->data()[i * _stride + j];
+  }
+
+  /**
+   * \returns A pointer to the first entry of the first row.
+   */
+  T * data () { return _storage.data() + _offset; }
+  const T * data () const { return _storage.data() + _offset; }
+
+  /**
+   * Copies \p src[i][j] for every i and j, resizing to match.
+   */
+  template <typename Src>
+  void assign_from (const std::vector<std::vector<Src>> & src)
+  {
+    const std::size_t n_cols = src.empty() ? 0 : src[0].size();
+    this->resize(src.size(), n_cols);
+    for (std::size_t i = 0; i != _n_rows; ++i)
+      {
+        libmesh_assert_equal_to (src[i].size(), n_cols);
+        std::copy(src[i].begin(), src[i].end(), (*this)[i].begin());
+      }
+  }
+
+private:
+
+  static std::size_t row_step ()
+  {
+    for (std::size_t n = 1; n * sizeof(T) <= 4 * alignment; ++n)
+      if (!(n * sizeof(T) % alignment))
+        return n;
+    return 1;
+  }
+
+  std::size_t aligned_offset (std::size_t step) const
+  {
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(_storage.data());
+    for (std::size_t o = 0; o != step; ++o)
+      if (!((base + o * sizeof(T)) % alignment))
+        return o;
+    return 0;
+  }
+
+  std::size_t _n_rows, _n_cols, _stride, _offset;
+
+  std::vector<T> _storage;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ALIGNED_ARRAY_2D_H
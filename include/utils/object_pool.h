@@ -0,0 +1,142 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_OBJECT_POOL_H
+#define LIBMESH_OBJECT_POOL_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <iostream>
+
+namespace libMesh
+{
+
+/**
+ * The \p ObjectPool class provides thread-safe slab storage for the
+ * many small, long-lived, heap-allocated objects a mesh is built
+ * from.  \p Elem and \p Node route their class-specific \p operator
+ * \p new and \p operator \p delete through it, so every element
+ * type gets its own size-segregated free list: elements and nodes
+ * created by mesh generation, I/O or refinement are carved out of
+ * contiguous slabs, and the slots released by coarsening are
+ * recycled by subsequent refinement rather than handed back to the
+ * system allocator.
+ *
+ * Pooling is disabled by default, in which case every request is
+ * forwarded to the global \p operator \p new.  It is enabled with the
+ * \p --enable-object-pools command line option, which \p LibMeshInit
+ * parses before any library object has been allocated.
+ *
+ * Slabs are returned to the system in bulk by \p release_memory()
+ * once every object of a given size has been deleted, e.g. when the
+ * last mesh has been cleared.
+ *
+ * \date 2021
+ * \brief Slab allocator for Elem and Node objects.
+ */
+class ObjectPool
+{
+public:
+
+  /**
+   * Enables pooled allocation.  This must be called before any
+   * object which allocates through the pool has been created, since
+   * deallocation is dispatched on the current setting.
+   */
+  static void enable ();
+
+  /**
+   * \returns \p true if pooled allocation has been enabled.
+   */
+  static bool enabled () { return _enabled; }
+
+  /**
+   * \returns Storage for an object of \p size bytes; from the pool
+   * for sufficiently small objects when pooling is enabled, from the
+   * global \p operator \p new otherwise.
+   */
+  static void * allocate (std::size_t size)
+  {
+    if (!_enabled || size > max_pooled_size)
+      return ::operator new(size);
+
+    return pool_allocate(size);
+  }
+
+  /**
+   * Returns the storage at \p p, previously obtained from \p
+   * allocate(size).
+   */
+  static void deallocate (void * p, std::size_t size)
+  {
+    if (!p)
+      return;
+
+    if (!_enabled || size > max_pooled_size)
+      return ::operator delete(p);
+
+    pool_deallocate(p, size);
+  }
+
+  /**
+   * Frees the slabs of every size class which currently has no
+   * objects allocated from it.
+   *
+   * \returns The number of bytes returned to the system.
+   */
+  static std::size_t release_memory ();
+
+  /**
+   * \returns The number of objects currently allocated from the pool.
+   */
+  static std::size_t n_objects ();
+
+  /**
+   * \returns The number of bytes currently reserved in slabs.
+   */
+  static std::size_t n_reserved_bytes ();
+
+  /**
+   * Prints per-size-class usage information to \p os.
+   */
+  static void print_info (std::ostream & os = libMesh::out);
+
+  /**
+   * Objects larger than this are never pooled.
+   */
+  static const std::size_t max_pooled_size = 1024;
+
+private:
+
+  static void * pool_allocate (std::size_t size);
+
+  static void pool_deallocate (void * p, std::size_t size);
+
+  /**
+   * Flag set by \p enable().
+   */
+  static bool _enabled;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_OBJECT_POOL_H
@@ -0,0 +1,132 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2021 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PERF_EVENT_COUNTERS_H
+#define LIBMESH_PERF_EVENT_COUNTERS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <array>
+#include <cstdint>
+
+namespace libMesh
+{
+
+/**
+ * This class reads the hardware performance counters of the calling
+ * thread through the Linux \p perf_event_open() interface.
+ *
+ * The counters are opened as one group, so that a single \p read()
+ * returns all of them consistently, and count user space only, which
+ * the default \p perf_event_paranoid setting allows unprivileged
+ * processes to do.  If the counters cannot be opened, because the
+ * kernel or the hardware doesn't support them, or because of the
+ * \p perf_event_paranoid setting or a missing \p
+ * <linux/perf_event.h>, \p available() returns \p false and \p read()
+ * fails.
+ *
+ * If the kernel has to multiplex the counters with other events, it
+ * only counts while they are scheduled, and \p read() scales the
+ * counts by the ratio of the time enabled to the time running.  Such
+ * estimates are not exact, and need not even increase monotonically.
+ *
+ * The counters are tied to the thread that constructed the object;
+ * they do not include the work of other threads.
+ *
+ * \date 2021
+ * \brief Hardware performance counters of the calling thread.
+ */
+class PerfEventCounters
+{
+public:
+
+  /**
+   * The counted events.
+   */
+  enum Event { CYCLES = 0,
+               INSTRUCTIONS,
+               CACHE_REFERENCES,
+               CACHE_MISSES,
+               N_EVENTS };
+
+  /**
+   * A reading of every counter.
+   */
+  typedef std::array<std::uint64_t, N_EVENTS> Counts;
+
+  /**
+   * Constructor.  Opens and starts the counters, if possible.
+   */
+  PerfEventCounters ();
+
+  /**
+   * This isn't a copyable object.
+   */
+  PerfEventCounters (const PerfEventCounters &) = delete;
+  PerfEventCounters & operator= (const PerfEventCounters &) = delete;
+
+  /**
+   * Destructor.  Closes the counters.
+   */
+  ~PerfEventCounters ();
+
+  /**
+   * \returns \p true if the counters could be opened.
+   */
+  bool available () const { return _group_fd != -1; }
+
+  /**
+   * Reads the current value of every counter into \p counts.
+   *
+   * \returns \p false, leaving \p counts unchanged, if the counters
+   * aren't available or could not be read.
+   */
+  bool read (Counts & counts) const;
+
+  /**
+   * \returns The number of times the counters were available but
+   * could not be read.
+   */
+  unsigned int n_failed_reads () const { return _n_failed_reads; }
+
+  /**
+   * \returns A short name for \p event.
+   */
+  static const char * event_name (Event event);
+
+private:
+
+  /**
+   * The file descriptors of the counters; the first one leads the
+   * group.
+   */
+  int _group_fd;
+  std::array<int, N_EVENTS> _fds;
+
+  /**
+   * The number of failed reads.
+   */
+  mutable unsigned int _n_failed_reads;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_PERF_EVENT_COUNTERS_H
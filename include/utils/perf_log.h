@@ -23,10 +23,12 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/perf_event_counters.h"
 
 // C++ includes
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <stack>
 #include <string>
 #include <vector>
@@ -57,7 +59,9 @@ public:
     tstart_incl_sub(),
     count(0),
     open(false),
-    called_recursively(0)
+    called_recursively(0),
+    tot_counts(),
+    counts_start()
   {}
 
 
@@ -104,6 +108,22 @@ public:
 
   int called_recursively;
 
+  /**
+   * The hardware counts accumulated in this event, excluding
+   * sub-events.  These remain zero unless the \p PerfLog is reading
+   * hardware counters.
+   */
+  PerfEventCounters::Counts tot_counts;
+
+  /**
+   * The hardware counts when the event was last started or
+   * restarted.
+   */
+  PerfEventCounters::Counts counts_start;
+
+  void start_counts (const PerfEventCounters::Counts & now);
+  void pause_counts (const PerfEventCounters::Counts & now);
+
 protected:
   double stop_or_pause(const bool do_stop);
 };
@@ -165,6 +185,30 @@ public:
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Starts reading the hardware performance counters of the calling
+   * thread (see \p PerfEventCounters) whenever an event is pushed or
+   * popped, and reporting the counts of each event with the log.
+   * Each reading costs a system call, so this is off by default.
+   * This can also be requested with the \p --perflog-hardware-counters
+   * command line option.  Counts are only accumulated for events
+   * logged after this call.
+   *
+   * \returns \p false, leaving the counters off, if they are not
+   * available on this system.
+   */
+  bool enable_hardware_counters();
+
+  /**
+   * Stops reading the hardware performance counters.
+   */
+  void disable_hardware_counters() { hardware_counters.reset(); }
+
+  /**
+   * \returns \p true iff hardware performance counters are read
+   */
+  bool hardware_counters_enabled() const { return hardware_counters.get(); }
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -267,6 +311,12 @@ public:
    */
   std::string get_perf_info() const;
 
+  /**
+   * \returns A string containing the hardware counts of each event,
+   * or an empty string if hardware counters are not enabled.
+   */
+  std::string get_hardware_counter_info() const;
+
   /**
    * Print the log.
    */
@@ -331,6 +381,13 @@ private:
    */
   std::stack<PerfData*> log_stack;
 
+  /**
+   * The hardware performance counters, if enabled, and a buffer for
+   * reading them, which keeps the last good reading if a read fails.
+   */
+  std::unique_ptr<PerfEventCounters> hardware_counters;
+  PerfEventCounters::Counts counts_now;
+
   /**
    * Flag indicating if print_log() has been called.
    * This is used to print a header with machine-specific
@@ -445,6 +502,25 @@ double PerfData::stopit ()
 
 
 
+inline
+void PerfData::start_counts (const PerfEventCounters::Counts & now)
+{
+  this->counts_start = now;
+}
+
+
+
+inline
+void PerfData::pause_counts (const PerfEventCounters::Counts & now)
+{
+  // Counts scaled for multiplexing may even decrease slightly
+  for (std::size_t e = 0; e != now.size(); ++e)
+    if (now[e] > this->counts_start[e])
+      this->tot_counts[e] += now[e] - this->counts_start[e];
+}
+
+
+
 // ------------------------------------------------------------
 // PerfLog class inline member functions
 inline
@@ -461,6 +537,15 @@ void PerfLog::fast_push (const char * label,
         total_time += log_stack.top()->pause_for(*perf_data);
       else
         perf_data->start();
+
+      if (hardware_counters)
+        {
+          hardware_counters->read(counts_now);
+          if (!log_stack.empty())
+            log_stack.top()->pause_counts(counts_now);
+          perf_data->start_counts(counts_now);
+        }
+
       log_stack.push(perf_data);
     }
 }
@@ -491,10 +576,20 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
 
       total_time += log_stack.top()->stopit();
 
+      if (hardware_counters)
+        {
+          hardware_counters->read(counts_now);
+          log_stack.top()->pause_counts(counts_now);
+        }
+
       log_stack.pop();
 
       if (!log_stack.empty())
-        log_stack.top()->restart();
+        {
+          log_stack.top()->restart();
+          if (hardware_counters)
+            log_stack.top()->start_counts(counts_now);
+        }
     }
 }
 
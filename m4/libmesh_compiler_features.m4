@@ -66,6 +66,10 @@ AC_C_RESTRICT
 # --------------------------------------------------------------
 enablegetpwuid_default=yes
 
+# PerfLog can read hardware performance counters through the Linux
+# perf_event_open() interface if its header is found.
+AC_CHECK_HEADERS(linux/perf_event.h)
+
 # We can't use getpwuid if pwd.h is not found.
 AC_CHECK_HEADERS(pwd.h, [have_pwd_h=yes], [have_pwd_h=no])
 AS_IF([test "$have_pwd_h" = no], [enablegetpwuid_default=no])
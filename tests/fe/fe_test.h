@@ -24,6 +24,8 @@
   CPPUNIT_TEST( testGradUComp );                \
   CPPUNIT_TEST( testHessU );                    \
   CPPUNIT_TEST( testHessUComp );                \
+  CPPUNIT_TEST( testRefShapes );                \
+  CPPUNIT_TEST( testContiguous );               \
   CPPUNIT_TEST( testDualDoesntScreamAndDie );
 
 using namespace libMesh;
@@ -388,6 +390,83 @@ public:
 #endif
   }
 
+  void testRefShapes()
+  {
+    // Clough-Tocher elements still don't work multithreaded
+    if (family == CLOUGH && libMesh::n_threads() > 1)
+      return;
+
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    // Values and master element derivatives computed in bulk by
+    // reinit() should match those computed one at a time
+    const std::vector<std::vector<Real>> * dphiref[3] =
+      { &_fe->get_dphidxi(), &_fe->get_dphideta(), &_fe->get_dphidzeta() };
+
+    _fe->reinit(_elem);
+
+    const FEType fe_type = _sys->variable_type(0);
+    const std::vector<std::vector<Real>> & phi = _fe->get_phi();
+    const std::vector<Point> & qpoints = _qrule->get_points();
+
+    for (auto i : index_range(phi))
+      for (auto qp : index_range(qpoints))
+        {
+          LIBMESH_ASSERT_FP_EQUAL
+            (FEInterface::shape(fe_type, _elem, i, qpoints[qp]),
+             phi[i][qp], value_tol);
+
+          for (unsigned int j = 0; j != _dim; ++j)
+            LIBMESH_ASSERT_FP_EQUAL
+              (FEInterface::shape_deriv(fe_type, _elem, i, j, qpoints[qp]),
+               (*dphiref[j])[i][qp], grad_tol);
+        }
+  }
+
+  void testContiguous()
+  {
+    // Clough-Tocher elements still don't work multithreaded
+    if (family == CLOUGH && libMesh::n_threads() > 1)
+      return;
+
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    const AlignedArray2D<Real> & flat_phi = _fe->get_contiguous_phi();
+    const AlignedArray2D<RealGradient> & flat_dphi = _fe->get_contiguous_dphi();
+    const AlignedArray2D<Real> & flat_dphidx = _fe->get_contiguous_dphidx();
+    const AlignedArray2D<Real> & flat_JxW = _fe->get_contiguous_JxW();
+    const AlignedArray2D<Real> & flat_xyz = _fe->get_contiguous_xyz();
+
+    _fe->reinit(_elem);
+
+    const std::vector<std::vector<Real>> & phi = _fe->get_phi();
+    const std::vector<std::vector<RealGradient>> & dphi = _fe->get_dphi();
+    const std::vector<Real> & JxW = _fe->get_JxW();
+    const std::vector<Point> & xyz = _fe->get_xyz();
+
+    CPPUNIT_ASSERT_EQUAL(phi.size(), flat_phi.size());
+    CPPUNIT_ASSERT_EQUAL(JxW.size(), flat_JxW.n_cols());
+
+    for (auto qp : index_range(JxW))
+      {
+        CPPUNIT_ASSERT_EQUAL(JxW[qp], flat_JxW[0][qp]);
+        for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+          CPPUNIT_ASSERT_EQUAL(xyz[qp](d), flat_xyz[d][qp]);
+      }
+
+    for (auto i : index_range(phi))
+      for (auto qp : index_range(phi[i]))
+        {
+          CPPUNIT_ASSERT_EQUAL(phi[i][qp], flat_phi[i][qp]);
+          CPPUNIT_ASSERT_EQUAL(dphi[i][qp](0), flat_dphi[i][qp](0));
+          CPPUNIT_ASSERT_EQUAL(dphi[i][qp](0), flat_dphidx[i][qp]);
+        }
+  }
+
   void testDualDoesntScreamAndDie()
   {
     // Clough-Tocher elements still don't work multithreaded